@@ -0,0 +1,337 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2023 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**
+ * @file dhcpv4c_bench.c
+ * @brief Latency and throughput benchmark of the DHCPv4C HAL getters.
+ *
+ * Implements the profile of the spec's "Performance Measurement" section. Every getter is run
+ * by 1, 2, 4, 8 and 16 concurrent processes. Each process makes the warm-up calls and then
+ * times every call with CLOCK_MONOTONIC. One JSON object per API and process count is printed
+ * on stdout.
+ *
+ * Usage: dhcpv4c_bench [-n calls] [-w warmup] [-p procs,...] [-a api-substring]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "dhcpv4c_api.h"
+
+#define BENCH_MAX_PROCS  64
+
+typedef int (*bench_fn_t)(void);
+
+typedef struct {
+    const char *pName;
+    bench_fn_t fn;
+} bench_api_t;
+
+/* Per-process results, in memory shared with the parent. */
+typedef struct {
+    uint64_t elapsedNs;
+    uint64_t errors;
+} bench_proc_result_t;
+
+#define BENCH_GETTER(name, type) \
+    static int bench_##name(void) { type v; return name(&v); }
+
+#define BENCH_MODULE_GETTERS(pfx, state_t, list_t)                \
+    BENCH_GETTER(pfx##_lease_time, unsigned int)                  \
+    BENCH_GETTER(pfx##_remain_lease_time, unsigned int)           \
+    BENCH_GETTER(pfx##_remain_renew_time, unsigned int)           \
+    BENCH_GETTER(pfx##_remain_rebind_time, unsigned int)          \
+    BENCH_GETTER(pfx##_config_attempts, int)                      \
+    BENCH_GETTER(pfx##_fsm_state, state_t)                        \
+    BENCH_GETTER(pfx##_ip_addr, unsigned int)                     \
+    BENCH_GETTER(pfx##_mask, unsigned int)                        \
+    BENCH_GETTER(pfx##_gw, unsigned int)                          \
+    BENCH_GETTER(pfx##_dns_svrs, list_t)                          \
+    BENCH_GETTER(pfx##_dhcp_svr, unsigned int)                    \
+    static int bench_##pfx##_ifname(void) { char n[MAX_IFNAME_LENGTH]; return pfx##_ifname(n); }
+
+BENCH_MODULE_GETTERS(dhcpv4c_get_ert, DhcpClientState, dhcpv4c_ip_list_t)
+BENCH_MODULE_GETTERS(dhcpv4c_get_ecm, DhcpClientState, dhcpv4c_ip_list_t)
+BENCH_MODULE_GETTERS(dhcp4c_get_ert, int, ipv4AddrList_t)
+BENCH_MODULE_GETTERS(dhcp4c_get_ecm, int, ipv4AddrList_t)
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+BENCH_GETTER(dhcpv4c_get_emta_remain_lease_time, unsigned int)
+BENCH_GETTER(dhcpv4c_get_emta_remain_renew_time, unsigned int)
+BENCH_GETTER(dhcpv4c_get_emta_remain_rebind_time, unsigned int)
+BENCH_GETTER(dhcp4c_get_emta_remain_lease_time, unsigned int)
+BENCH_GETTER(dhcp4c_get_emta_remain_renew_time, unsigned int)
+BENCH_GETTER(dhcp4c_get_emta_remain_rebind_time, unsigned int)
+#endif
+
+static int bench_dhcpv4c_get_lease_snapshot(void)
+{
+    dhcpv4c_lease_snapshot_t s;
+    return dhcpv4c_get_lease_snapshot(DHCPC_EROUTER, &s);
+}
+
+static int bench_dhcp4c_get_lease_snapshot(void)
+{
+    dhcp4cLeaseSnapshot_t s;
+    return dhcp4c_get_lease_snapshot(DHCPC_EROUTER, &s);
+}
+
+static int bench_dhcp4c_get(void)
+{
+    static const enum DHCPC_CMD cmds[] = {
+        DHCPC_CMD_IP_ADDR, DHCPC_CMD_IP_MASK, DHCPC_CMD_DNS_SVRS, DHCPC_CMD_LEASE_TIME_REMAIN
+    };
+    dhcp4cValue_t values[sizeof(cmds) / sizeof(cmds[0])];
+    return dhcp4c_get(DHCPC_EROUTER, cmds, sizeof(cmds) / sizeof(cmds[0]), values);
+}
+
+static int bench_dhcpv4c_get_lease_generation(void)
+{
+    uint64_t g;
+    return dhcpv4c_get_lease_generation(DHCPC_EROUTER, &g);
+}
+
+#define BENCH_API(fn)  { #fn, bench_##fn }
+#define BENCH_MODULE_APIS(pfx)                                                  \
+    BENCH_API(pfx##_lease_time), BENCH_API(pfx##_remain_lease_time),           \
+    BENCH_API(pfx##_remain_renew_time), BENCH_API(pfx##_remain_rebind_time),   \
+    BENCH_API(pfx##_config_attempts), BENCH_API(pfx##_ifname),                 \
+    BENCH_API(pfx##_fsm_state), BENCH_API(pfx##_ip_addr),                      \
+    BENCH_API(pfx##_mask), BENCH_API(pfx##_gw),                                \
+    BENCH_API(pfx##_dns_svrs), BENCH_API(pfx##_dhcp_svr)
+
+static const bench_api_t g_apis[] = {
+    BENCH_MODULE_APIS(dhcpv4c_get_ert),
+    BENCH_MODULE_APIS(dhcpv4c_get_ecm),
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+    BENCH_API(dhcpv4c_get_emta_remain_lease_time),
+    BENCH_API(dhcpv4c_get_emta_remain_renew_time),
+    BENCH_API(dhcpv4c_get_emta_remain_rebind_time),
+#endif
+    BENCH_MODULE_APIS(dhcp4c_get_ert),
+    BENCH_MODULE_APIS(dhcp4c_get_ecm),
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+    BENCH_API(dhcp4c_get_emta_remain_lease_time),
+    BENCH_API(dhcp4c_get_emta_remain_renew_time),
+    BENCH_API(dhcp4c_get_emta_remain_rebind_time),
+#endif
+    BENCH_API(dhcpv4c_get_lease_snapshot),
+    BENCH_API(dhcp4c_get_lease_snapshot),
+    BENCH_API(dhcp4c_get),
+    BENCH_API(dhcpv4c_get_lease_generation),
+};
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int bench_cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted array, `per_mille` in [0, 1000]. */
+static uint64_t bench_percentile(const uint64_t *pSorted, size_t n, unsigned int per_mille)
+{
+    size_t rank = (n * per_mille + 999) / 1000;
+    return pSorted[rank ? rank - 1 : 0];
+}
+
+static void bench_worker(bench_fn_t fn, unsigned long warmup, unsigned long calls, int startFd,
+                         uint64_t *pSamples, bench_proc_result_t *pResult)
+{
+    uint64_t start, t0, t1, errors = 0;
+    unsigned long i;
+    char c;
+
+    for (i = 0; i < warmup; i++)
+        (void)fn();
+
+    /*
+     * Wait until the parent releases all workers at once with one byte each. End of file
+     * without a byte means the run was aborted.
+     */
+    if (read(startFd, &c, 1) != 1)
+        _exit(1);
+
+    start = bench_now_ns();
+    for (i = 0; i < calls; i++) {
+        t0 = bench_now_ns();
+        if (fn() != STATUS_SUCCESS)
+            errors++;
+        t1 = bench_now_ns();
+        pSamples[i] = t1 - t0;
+    }
+    pResult->elapsedNs = bench_now_ns() - start;
+    pResult->errors = errors;
+}
+
+static int bench_run(const bench_api_t *pApi, unsigned int procs, unsigned long warmup, unsigned long calls)
+{
+    size_t total = (size_t)procs * calls;
+    size_t sampleBytes = total * sizeof(uint64_t);
+    size_t resultBytes = procs * sizeof(bench_proc_result_t);
+    uint64_t *pSamples;
+    bench_proc_result_t *pResults;
+    uint64_t maxElapsed = 0, errors = 0;
+    pid_t pids[BENCH_MAX_PROCS];
+    char go[BENCH_MAX_PROCS];
+    int started;
+    int startPipe[2];
+    unsigned int p;
+    void *pMem;
+
+    pMem = mmap(NULL, sampleBytes + resultBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (pMem == MAP_FAILED) {
+        perror("dhcpv4c_bench");
+        return -1;
+    }
+    if (pipe(startPipe) != 0) {
+        perror("dhcpv4c_bench");
+        munmap(pMem, sampleBytes + resultBytes);
+        return -1;
+    }
+    pSamples = pMem;
+    pResults = (bench_proc_result_t *)((char *)pMem + sampleBytes);
+
+    for (p = 0; p < procs; p++) {
+        pid_t pid = fork();
+
+        if (pid < 0) {
+            unsigned int q;
+
+            perror("fork");
+            /* The workers already forked get end of file on the start pipe and exit. */
+            close(startPipe[0]);
+            close(startPipe[1]);
+            for (q = 0; q < p; q++)
+                waitpid(pids[q], NULL, 0);
+            munmap(pMem, sampleBytes + resultBytes);
+            return -1;
+        }
+        if (pid == 0) {
+            close(startPipe[1]);
+            bench_worker(pApi->fn, warmup, calls, startPipe[0], pSamples + (size_t)p * calls, &pResults[p]);
+            _exit(0);
+        }
+        pids[p] = pid;
+    }
+
+    /* A single write wakes every worker's read() at the same time. */
+    memset(go, 0, sizeof(go));
+    close(startPipe[0]);
+    started = (write(startPipe[1], go, procs) == (ssize_t)procs);
+    close(startPipe[1]);
+    for (p = 0; p < procs; p++)
+        waitpid(pids[p], NULL, 0);
+    if (!started) {
+        perror("dhcpv4c_bench: write");
+        munmap(pMem, sampleBytes + resultBytes);
+        return -1;
+    }
+
+    for (p = 0; p < procs; p++) {
+        if (pResults[p].elapsedNs > maxElapsed)
+            maxElapsed = pResults[p].elapsedNs;
+        errors += pResults[p].errors;
+    }
+
+    qsort(pSamples, total, sizeof(uint64_t), bench_cmp_u64);
+    printf("{\"api\":\"%s\",\"procs\":%u,\"calls\":%zu,\"errors\":%llu,"
+           "\"p50_ns\":%llu,\"p99_ns\":%llu,\"p999_ns\":%llu,\"calls_per_sec\":%.0f}\n",
+           pApi->pName, procs, total, (unsigned long long)errors,
+           (unsigned long long)bench_percentile(pSamples, total, 500),
+           (unsigned long long)bench_percentile(pSamples, total, 990),
+           (unsigned long long)bench_percentile(pSamples, total, 999),
+           maxElapsed ? (double)total * 1e9 / (double)maxElapsed : 0.0);
+    fflush(stdout);
+
+    munmap(pMem, sampleBytes + resultBytes);
+    return 0;
+}
+
+static void bench_usage(const char *pProg)
+{
+    fprintf(stderr, "usage: %s [-n calls] [-w warmup] [-p procs,...] [-a api-substring]\n", pProg);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long calls = 100000, warmup = 1000;
+    unsigned int procList[BENCH_MAX_PROCS] = { 1, 2, 4, 8, 16 };
+    unsigned int numProcs = 5;
+    const char *pFilter = NULL;
+    size_t i;
+    unsigned int j;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:w:p:a:h")) != -1) {
+        switch (opt) {
+        case 'n':
+            calls = strtoul(optarg, NULL, 0);
+            break;
+        case 'w':
+            warmup = strtoul(optarg, NULL, 0);
+            break;
+        case 'p': {
+            char *pTok = strtok(optarg, ",");
+
+            for (numProcs = 0; pTok != NULL && numProcs < BENCH_MAX_PROCS; pTok = strtok(NULL, ",")) {
+                unsigned long n = strtoul(pTok, NULL, 0);
+
+                if (n == 0 || n > BENCH_MAX_PROCS) {
+                    bench_usage(argv[0]);
+                    return 1;
+                }
+                procList[numProcs++] = (unsigned int)n;
+            }
+            break;
+        }
+        case 'a':
+            pFilter = optarg;
+            break;
+        default:
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (calls == 0 || numProcs == 0) {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(g_apis) / sizeof(g_apis[0]); i++) {
+        if (pFilter != NULL && strstr(g_apis[i].pName, pFilter) == NULL)
+            continue;
+        for (j = 0; j < numProcs; j++) {
+            if (bench_run(&g_apis[i], procList[j], warmup, calls) != 0)
+                return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,381 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2023 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**
+ * @file dhcpv4c_dora.c
+ * @brief DORA load generator for the DHCPv4 server.
+ *
+ * Implements the measurement of the spec's "Server Packet I/O" section. Every simulated client
+ * has its own MAC address and runs one complete DISCOVER/OFFER/REQUEST/ACK exchange with the
+ * broadcast flag set, so the server's replies come back to this process on port 68. At most
+ * `window` exchanges are in flight at any time. The result is printed as one JSON object in the
+ * format of the spec's "Performance Measurement" section, with `"api":"dhcpv4c_srv_dora"`.
+ *
+ * The generator does not use the HAL. It is run as root on one end of a veth pair whose other
+ * end is served by `dhcpv4c_srv_start()`.
+ *
+ * Usage: dhcpv4c_dora -i ifname [-c clients] [-w window] [-t timeout-ms] [-m mac-base] [-s server]
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "dhcpv4c_api.h"
+
+#define DORA_SERVER_PORT    67
+#define DORA_CLIENT_PORT    68
+#define DORA_BOOTP_LEN      236         /* Fixed BOOTP header, up to `file`. */
+#define DORA_MAGIC_COOKIE   0x63825363
+#define DORA_PKT_MAX        1500
+#define DORA_RECV_BATCH     32
+
+#define DORA_MSG_DISCOVER   1
+#define DORA_MSG_OFFER      2
+#define DORA_MSG_REQUEST    3
+#define DORA_MSG_ACK        5
+#define DORA_MSG_NAK        6
+
+typedef enum {
+    DORA_IDLE,
+    DORA_WAIT_OFFER,
+    DORA_WAIT_ACK,
+    DORA_DONE,
+    DORA_FAILED
+} dora_state_t;
+
+typedef struct {
+    dora_state_t state;
+    uint64_t startNs;      /* Time the DISCOVER was sent. */
+    uint64_t deadlineNs;   /* Time after which the exchange counts as failed. */
+    uint32_t offeredIp;    /* `yiaddr` of the OFFER, network byte order. */
+    uint32_t serverId;     /* Option 54 of the OFFER, network byte order. */
+} dora_client_t;
+
+static uint64_t dora_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int dora_cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted array, `per_mille` in [0, 1000]. */
+static uint64_t dora_percentile(const uint64_t *pSorted, size_t n, unsigned int per_mille)
+{
+    size_t rank = (n * per_mille + 999) / 1000;
+    return (n == 0) ? 0 : pSorted[rank ? rank - 1 : 0];
+}
+
+/* Locally administered MAC address of client `idx`. */
+static void dora_mac(uint32_t macBase, uint32_t idx, UCHAR *pMac)
+{
+    uint32_t v = macBase + idx;
+
+    pMac[0] = 0x02;
+    pMac[1] = 0x00;
+    pMac[2] = (UCHAR)(v >> 24);
+    pMac[3] = (UCHAR)(v >> 16);
+    pMac[4] = (UCHAR)(v >> 8);
+    pMac[5] = (UCHAR)v;
+}
+
+/* Builds a DISCOVER or REQUEST of client `idx` into `pPkt`; returns its length. */
+static size_t dora_build(UCHAR *pPkt, int msgType, uint32_t xid, const UCHAR *pMac, const dora_client_t *pClient)
+{
+    UCHAR *p = pPkt + DORA_BOOTP_LEN;
+    uint32_t v;
+
+    memset(pPkt, 0, DORA_BOOTP_LEN);
+    pPkt[0] = 1;                            /* op: BOOTREQUEST */
+    pPkt[1] = 1;                            /* htype: Ethernet */
+    pPkt[2] = DHCPV4C_SRV_MAC_LEN;          /* hlen */
+    v = htonl(xid);
+    memcpy(pPkt + 4, &v, 4);
+    pPkt[10] = 0x80;                        /* flags: broadcast */
+    memcpy(pPkt + 28, pMac, DHCPV4C_SRV_MAC_LEN);
+
+    v = htonl(DORA_MAGIC_COOKIE);
+    memcpy(p, &v, 4);
+    p += 4;
+    *p++ = 53; *p++ = 1; *p++ = (UCHAR)msgType;
+    if (msgType == DORA_MSG_REQUEST) {
+        *p++ = 50; *p++ = 4; memcpy(p, &pClient->offeredIp, 4); p += 4;
+        *p++ = 54; *p++ = 4; memcpy(p, &pClient->serverId, 4); p += 4;
+    }
+    *p++ = 55; *p++ = 4; *p++ = 1; *p++ = 3; *p++ = 6; *p++ = 51;
+    *p++ = 255;
+    return (size_t)(p - pPkt);
+}
+
+/*
+ * Parses a BOOTREPLY. Returns the message type and sets `*pXid`, `*pYiaddr` and `*pServerId`,
+ * or returns -1 if the packet is not a DHCP reply.
+ */
+static int dora_parse(const UCHAR *pPkt, size_t len, uint32_t *pXid, uint32_t *pYiaddr, uint32_t *pServerId)
+{
+    const UCHAR *p = pPkt + DORA_BOOTP_LEN + 4;
+    const UCHAR *pEnd = pPkt + len;
+    uint32_t cookie;
+    int msgType = -1;
+
+    if (len < DORA_BOOTP_LEN + 4 || pPkt[0] != 2)
+        return -1;
+    memcpy(&cookie, pPkt + DORA_BOOTP_LEN, 4);
+    if (ntohl(cookie) != DORA_MAGIC_COOKIE)
+        return -1;
+    memcpy(pXid, pPkt + 4, 4);
+    *pXid = ntohl(*pXid);
+    memcpy(pYiaddr, pPkt + 16, 4);
+    *pServerId = 0;
+
+    while (p < pEnd && *p != 255) {
+        if (*p == 0) {
+            p++;
+            continue;
+        }
+        if (p + 2 > pEnd || p + 2 + p[1] > pEnd)
+            break;
+        if (p[0] == 53 && p[1] == 1)
+            msgType = p[2];
+        else if (p[0] == 54 && p[1] == 4)
+            memcpy(pServerId, p + 2, 4);
+        p += 2 + p[1];
+    }
+    return msgType;
+}
+
+static int dora_open(const char *pIfName)
+{
+    struct sockaddr_in addr;
+    int one = 1;
+    int fd;
+
+    fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        return -1;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0 ||
+        setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one)) != 0 ||
+        setsockopt(fd, SOL_SOCKET, SO_BINDTODEVICE, pIfName, strlen(pIfName) + 1) != 0) {
+        close(fd);
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(DORA_CLIENT_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void dora_usage(const char *pProg)
+{
+    fprintf(stderr, "usage: %s -i ifname [-c clients] [-w window] [-t timeout-ms] [-m mac-base] [-s server]\n", pProg);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pIfName = NULL;
+    unsigned long clients = 1000, window = 64, timeoutMs = 2000;
+    uint32_t macBase = 0, xidBase;
+    struct sockaddr_in server;
+    dora_client_t *pClients;
+    uint64_t *pSamples;
+    uint64_t firstNs = 0, lastNs = 0;
+    unsigned long next = 0, oldest = 0, inFlight = 0, done = 0, failed = 0, i;
+    UCHAR pkt[DORA_PKT_MAX];
+    int fd, opt;
+
+    memset(&server, 0, sizeof(server));
+    server.sin_family = AF_INET;
+    server.sin_port = htons(DORA_SERVER_PORT);
+    server.sin_addr.s_addr = htonl(INADDR_BROADCAST);
+
+    while ((opt = getopt(argc, argv, "i:c:w:t:m:s:h")) != -1) {
+        switch (opt) {
+        case 'i':
+            pIfName = optarg;
+            break;
+        case 'c':
+            clients = strtoul(optarg, NULL, 0);
+            break;
+        case 'w':
+            window = strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            timeoutMs = strtoul(optarg, NULL, 0);
+            break;
+        case 'm':
+            macBase = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            if (inet_pton(AF_INET, optarg, &server.sin_addr) != 1) {
+                dora_usage(argv[0]);
+                return 1;
+            }
+            break;
+        default:
+            dora_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (pIfName == NULL || clients == 0 || window == 0 || timeoutMs == 0) {
+        dora_usage(argv[0]);
+        return 1;
+    }
+
+    fd = dora_open(pIfName);
+    if (fd < 0) {
+        perror("dhcpv4c_dora");
+        return 1;
+    }
+    pClients = calloc(clients, sizeof(*pClients));
+    pSamples = calloc(clients, sizeof(*pSamples));
+    if (pClients == NULL || pSamples == NULL) {
+        perror("dhcpv4c_dora");
+        close(fd);
+        return 1;
+    }
+
+    /* Replies are matched to clients by xid, which is `xidBase + index`. */
+    srand((unsigned int)dora_now_ns());
+    xidBase = (uint32_t)rand() << 16;
+
+    while (done + failed < clients) {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        uint64_t now = dora_now_ns();
+
+        /* Start new exchanges up to the window. */
+        while (inFlight < window && next < clients) {
+            UCHAR mac[DHCPV4C_SRV_MAC_LEN];
+            dora_client_t *pC = &pClients[next];
+            size_t len;
+
+            dora_mac(macBase, (uint32_t)next, mac);
+            len = dora_build(pkt, DORA_MSG_DISCOVER, xidBase + (uint32_t)next, mac, pC);
+            pC->state = DORA_WAIT_OFFER;
+            pC->startNs = now;
+            pC->deadlineNs = now + (uint64_t)timeoutMs * 1000000ULL;
+            if (firstNs == 0)
+                firstNs = now;
+            if (sendto(fd, pkt, len, 0, (struct sockaddr *)&server, sizeof(server)) < 0) {
+                pC->state = DORA_FAILED;
+                failed++;
+            } else {
+                inFlight++;
+            }
+            next++;
+        }
+
+        if (poll(&pfd, 1, 10) < 0 && errno != EINTR) {
+            perror("dhcpv4c_dora: poll");
+            break;
+        }
+
+        /* Drain the replies that have arrived. */
+        for (i = 0; i < DORA_RECV_BATCH; i++) {
+            ssize_t n = recv(fd, pkt, sizeof(pkt), MSG_DONTWAIT);
+            uint32_t xid, yiaddr, serverId, idx;
+            dora_client_t *pC;
+            int type;
+
+            if (n < 0)
+                break;
+            type = dora_parse(pkt, (size_t)n, &xid, &yiaddr, &serverId);
+            idx = xid - xidBase;
+            if (type < 0 || idx >= clients)
+                continue;
+            pC = &pClients[idx];
+
+            if (type == DORA_MSG_OFFER && pC->state == DORA_WAIT_OFFER) {
+                UCHAR mac[DHCPV4C_SRV_MAC_LEN];
+                size_t len;
+
+                pC->offeredIp = yiaddr;
+                pC->serverId = serverId;
+                pC->state = DORA_WAIT_ACK;
+                dora_mac(macBase, idx, mac);
+                len = dora_build(pkt, DORA_MSG_REQUEST, xid, mac, pC);
+                if (sendto(fd, pkt, len, 0, (struct sockaddr *)&server, sizeof(server)) < 0) {
+                    pC->state = DORA_FAILED;
+                    failed++;
+                    inFlight--;
+                }
+            } else if (pC->state == DORA_WAIT_ACK && (type == DORA_MSG_ACK || type == DORA_MSG_NAK)) {
+                lastNs = dora_now_ns();
+                inFlight--;
+                if (type == DORA_MSG_ACK) {
+                    pSamples[done++] = lastNs - pC->startNs;
+                    pC->state = DORA_DONE;
+                } else {
+                    pC->state = DORA_FAILED;
+                    failed++;
+                }
+            }
+        }
+
+        /*
+         * Exchanges past their deadline count as failed; there are no retransmissions. Clients
+         * start in index order, so deadlines grow with the index and the scan stops at the
+         * first exchange that is still in time.
+         */
+        now = dora_now_ns();
+        for (i = oldest; i < next && pClients[i].deadlineNs <= now; i++) {
+            dora_client_t *pC = &pClients[i];
+
+            if (pC->state == DORA_WAIT_OFFER || pC->state == DORA_WAIT_ACK) {
+                pC->state = DORA_FAILED;
+                failed++;
+                inFlight--;
+            }
+        }
+        while (oldest < next && (pClients[oldest].state == DORA_DONE || pClients[oldest].state == DORA_FAILED))
+            oldest++;
+    }
+
+    qsort(pSamples, done, sizeof(uint64_t), dora_cmp_u64);
+    printf("{\"api\":\"dhcpv4c_srv_dora\",\"clients\":%lu,\"window\":%lu,\"completed\":%lu,\"errors\":%lu,"
+           "\"p50_ns\":%llu,\"p99_ns\":%llu,\"p999_ns\":%llu,\"dora_per_sec\":%.0f}\n",
+           clients, window, done, failed,
+           (unsigned long long)dora_percentile(pSamples, done, 500),
+           (unsigned long long)dora_percentile(pSamples, done, 990),
+           (unsigned long long)dora_percentile(pSamples, done, 999),
+           (lastNs > firstNs) ? (double)done * 1e9 / (double)(lastNs - firstNs) : 0.0);
+
+    free(pSamples);
+    free(pClients);
+    close(fd);
+    return (done > 0) ? 0 : 1;
+}
@@ -0,0 +1,306 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2023 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**
+ * @file dhcpv4c_stub.c
+ * @brief Stub backend used by the getter benchmark.
+ *
+ * Implements the benchmarked getters the way the spec's Getter Path describes: a simulated
+ * lease is published into a `dhcpv4c_lease_shm_t` segment under its sequence counter, and
+ * every getter copies the module's record and extracts the requested field. The segment is an
+ * anonymous shared mapping created when the library is loaded, so processes forked by the
+ * benchmark share it and the system's `DHCPV4C_LEASE_SHM_NAME` segment is never touched.
+ */
+
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#include "dhcpv4c_api.h"
+
+static dhcpv4c_lease_shm_t *g_shm;
+
+static uint64_t stub_now_ns(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static UINT stub_remain_sec(uint64_t deadlineNs, uint64_t nowNs)
+{
+    return (deadlineNs > nowNs) ? (UINT)((deadlineNs - nowNs) / 1000000000ULL) : 0;
+}
+
+static INT stub_read_lease(enum DHCPC_MODULE module, dhcpv4c_lease_snapshot_t *pLease)
+{
+    const dhcpv4c_lease_record_t *pRec;
+    uint32_t seq;
+    uint64_t now;
+
+    if (g_shm == NULL || (int)module < 0 || module >= DHCPC_MODULE_MAX || pLease == NULL)
+        return STATUS_FAILURE;
+
+    pRec = &g_shm->records[module];
+    do {
+        while ((seq = __atomic_load_n(&pRec->seq, __ATOMIC_ACQUIRE)) & 1)
+            ;
+        memcpy(pLease, &pRec->lease, sizeof(*pLease));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&pRec->seq, __ATOMIC_RELAXED) != seq);
+
+    if (pLease->generation == 0)
+        return STATUS_FAILURE;
+
+    now = stub_now_ns(CLOCK_MONOTONIC);
+    pLease->remainLeaseTime  = stub_remain_sec(pLease->deadlines.expiryNs, now);
+    pLease->remainRenewTime  = stub_remain_sec(pLease->deadlines.renewNs, now);
+    pLease->remainRebindTime = stub_remain_sec(pLease->deadlines.rebindNs, now);
+    return STATUS_SUCCESS;
+}
+
+INT dhcpv4c_publish_lease(enum DHCPC_MODULE module, const dhcpv4c_lease_snapshot_t *pSnapshot)
+{
+    dhcpv4c_lease_record_t *pRec;
+    uint64_t generation;
+
+    if (g_shm == NULL || (int)module < 0 || module >= DHCPC_MODULE_MAX || pSnapshot == NULL)
+        return STATUS_FAILURE;
+
+    pRec = &g_shm->records[module];
+    generation = pRec->generation ? pRec->generation + 1 : g_shm->generationBase + 1;
+
+    __atomic_store_n(&pRec->seq, pRec->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&pRec->lease, pSnapshot, sizeof(pRec->lease));
+    pRec->lease.generation = generation;
+    pRec->updatedNs = stub_now_ns(CLOCK_MONOTONIC);
+    __atomic_store_n(&pRec->generation, generation, __ATOMIC_RELAXED);
+    __atomic_store_n(&pRec->seq, pRec->seq + 1, __ATOMIC_RELEASE);
+    return STATUS_SUCCESS;
+}
+
+static void stub_publish(enum DHCPC_MODULE module, const CHAR *pIfName, UINT ipAddr)
+{
+    dhcpv4c_lease_snapshot_t lease;
+    uint64_t now = stub_now_ns(CLOCK_MONOTONIC);
+
+    memset(&lease, 0, sizeof(lease));
+    lease.leaseTime = 86400;
+    lease.configAttempts = 1;
+    strncpy(lease.ifName, pIfName, sizeof(lease.ifName) - 1);
+    lease.fsmState = DHCPC_STATE_BOUND;
+    lease.ipAddr = ipAddr;
+    lease.mask = 0xFFFFFF00;
+    lease.gw = (ipAddr & 0xFFFFFF00) | 1;
+    lease.dnsSvrs.number = 2;
+    lease.dnsSvrs.addrs[0] = 0x08080808;
+    lease.dnsSvrs.addrs[1] = 0x08080404;
+    lease.dhcpSvr = lease.gw;
+    lease.deadlines.acquiredNs = now;
+    lease.deadlines.renewNs    = now + 43200ULL * 1000000000ULL;
+    lease.deadlines.rebindNs   = now + 75600ULL * 1000000000ULL;
+    lease.deadlines.expiryNs   = now + 86400ULL * 1000000000ULL;
+    dhcpv4c_publish_lease(module, &lease);
+}
+
+__attribute__((constructor))
+static void stub_init(void)
+{
+    void *p = mmap(NULL, sizeof(*g_shm), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (p == MAP_FAILED)
+        return;
+
+    g_shm = p;
+    g_shm->magic = DHCPV4C_LEASE_SHM_MAGIC;
+    g_shm->version = DHCPV4C_LEASE_SHM_VERSION;
+    g_shm->size = sizeof(*g_shm);
+    g_shm->generationBase = stub_now_ns(CLOCK_BOOTTIME);
+
+    stub_publish(DHCPC_EROUTER, "erouter0", 0xC0A80064);
+    stub_publish(DHCPC_ECM, "wan0", 0x0A000064);
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+    stub_publish(DHCPC_EMTA, "mta0", 0x0A010064);
+#endif
+}
+
+/* Per-field getters: one record copy, one field. */
+#define STUB_GETTER(name, module, type, expr)                        \
+    INT dhcpv4c_get_##name(type *pValue)                             \
+    {                                                                \
+        dhcpv4c_lease_snapshot_t l;                                  \
+        if (pValue == NULL || stub_read_lease(module, &l))           \
+            return STATUS_FAILURE;                                   \
+        *pValue = (expr);                                            \
+        return STATUS_SUCCESS;                                       \
+    }
+
+#define STUB_MODULE_GETTERS(mod, module)                                                      \
+    STUB_GETTER(mod##_lease_time, module, UINT, l.leaseTime)                                 \
+    STUB_GETTER(mod##_remain_lease_time, module, UINT, l.remainLeaseTime)                    \
+    STUB_GETTER(mod##_remain_renew_time, module, UINT, l.remainRenewTime)                    \
+    STUB_GETTER(mod##_remain_rebind_time, module, UINT, l.remainRebindTime)                  \
+    STUB_GETTER(mod##_config_attempts, module, INT, l.configAttempts)                        \
+    STUB_GETTER(mod##_fsm_state, module, DhcpClientState, (DhcpClientState)l.fsmState)       \
+    STUB_GETTER(mod##_ip_addr, module, UINT, l.ipAddr)                                       \
+    STUB_GETTER(mod##_mask, module, UINT, l.mask)                                            \
+    STUB_GETTER(mod##_gw, module, UINT, l.gw)                                                \
+    STUB_GETTER(mod##_dns_svrs, module, dhcpv4c_ip_list_t, l.dnsSvrs)                        \
+    STUB_GETTER(mod##_dhcp_svr, module, UINT, l.dhcpSvr)                                     \
+    INT dhcpv4c_get_##mod##_ifname(CHAR *pName)                                               \
+    {                                                                                         \
+        dhcpv4c_lease_snapshot_t l;                                                           \
+        if (pName == NULL || stub_read_lease(module, &l))                                     \
+            return STATUS_FAILURE;                                                            \
+        memcpy(pName, l.ifName, sizeof(l.ifName));                                            \
+        return STATUS_SUCCESS;                                                                \
+    }
+
+STUB_MODULE_GETTERS(ert, DHCPC_EROUTER)
+STUB_MODULE_GETTERS(ecm, DHCPC_ECM)
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+STUB_GETTER(emta_remain_lease_time, DHCPC_EMTA, UINT, l.remainLeaseTime)
+STUB_GETTER(emta_remain_renew_time, DHCPC_EMTA, UINT, l.remainRenewTime)
+STUB_GETTER(emta_remain_rebind_time, DHCPC_EMTA, UINT, l.remainRebindTime)
+#endif
+
+INT dhcpv4c_get_lease_snapshot(enum DHCPC_MODULE module, dhcpv4c_lease_snapshot_t *pSnapshot)
+{
+    return (pSnapshot == NULL) ? STATUS_FAILURE : stub_read_lease(module, pSnapshot);
+}
+
+INT dhcpv4c_get_lease_generation(enum DHCPC_MODULE module, uint64_t *pGeneration)
+{
+    if (g_shm == NULL || (int)module < 0 || module >= DHCPC_MODULE_MAX || pGeneration == NULL)
+        return STATUS_FAILURE;
+
+    *pGeneration = __atomic_load_n(&g_shm->records[module].generation, __ATOMIC_ACQUIRE);
+    return (*pGeneration != 0) ? STATUS_SUCCESS : STATUS_FAILURE;
+}
+
+/* dhcp4cApi.h mirrors. */
+static void stub_copy_list(ipv4AddrList_t *pDst, const dhcpv4c_ip_list_t *pSrc)
+{
+    pDst->number = pSrc->number;
+    memcpy(pDst->addrList, pSrc->addrs, sizeof(pDst->addrList));
+}
+
+#define STUB_MIRROR(name, type) \
+    int dhcp4c_get_##name(type *pValue) { return dhcpv4c_get_##name(pValue); }
+
+#define STUB_MODULE_MIRRORS(mod)                                                  \
+    STUB_MIRROR(mod##_lease_time, unsigned int)                                  \
+    STUB_MIRROR(mod##_remain_lease_time, unsigned int)                           \
+    STUB_MIRROR(mod##_remain_renew_time, unsigned int)                           \
+    STUB_MIRROR(mod##_remain_rebind_time, unsigned int)                          \
+    STUB_MIRROR(mod##_config_attempts, int)                                      \
+    STUB_MIRROR(mod##_ifname, char)                                              \
+    STUB_MIRROR(mod##_ip_addr, unsigned int)                                     \
+    STUB_MIRROR(mod##_mask, unsigned int)                                        \
+    STUB_MIRROR(mod##_gw, unsigned int)                                          \
+    STUB_MIRROR(mod##_dhcp_svr, unsigned int)                                    \
+    int dhcp4c_get_##mod##_fsm_state(int *pValue)                                 \
+    {                                                                             \
+        DhcpClientState state;                                                    \
+        int rc = dhcpv4c_get_##mod##_fsm_state(&state);                           \
+        if (rc == STATUS_SUCCESS || rc == STATUS_STALE)                           \
+            *pValue = state;                                                      \
+        return rc;                                                                \
+    }                                                                             \
+    int dhcp4c_get_##mod##_dns_svrs(ipv4AddrList_t *pList)                        \
+    {                                                                             \
+        dhcpv4c_ip_list_t list;                                                   \
+        if (pList == NULL || dhcpv4c_get_##mod##_dns_svrs(&list))                 \
+            return STATUS_FAILURE;                                                \
+        stub_copy_list(pList, &list);                                             \
+        return STATUS_SUCCESS;                                                    \
+    }
+
+STUB_MODULE_MIRRORS(ert)
+STUB_MODULE_MIRRORS(ecm)
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+STUB_MIRROR(emta_remain_lease_time, unsigned int)
+STUB_MIRROR(emta_remain_renew_time, unsigned int)
+STUB_MIRROR(emta_remain_rebind_time, unsigned int)
+#endif
+
+int dhcp4c_get_lease_snapshot(enum DHCPC_MODULE module, dhcp4cLeaseSnapshot_t *pSnapshot)
+{
+    dhcpv4c_lease_snapshot_t l;
+
+    if (pSnapshot == NULL || stub_read_lease(module, &l))
+        return STATUS_FAILURE;
+
+    memset(pSnapshot, 0, sizeof(*pSnapshot));
+    pSnapshot->leaseTime = l.leaseTime;
+    pSnapshot->remainLeaseTime = l.remainLeaseTime;
+    pSnapshot->remainRenewTime = l.remainRenewTime;
+    pSnapshot->remainRebindTime = l.remainRebindTime;
+    pSnapshot->configAttempts = l.configAttempts;
+    memcpy(pSnapshot->ifName, l.ifName, sizeof(pSnapshot->ifName));
+    pSnapshot->fsmState = l.fsmState;
+    pSnapshot->ipAddr = l.ipAddr;
+    pSnapshot->mask = l.mask;
+    pSnapshot->gw = l.gw;
+    stub_copy_list(&pSnapshot->dnsSvrs, &l.dnsSvrs);
+    pSnapshot->dhcpSvr = l.dhcpSvr;
+    pSnapshot->acquiredNs = l.deadlines.acquiredNs;
+    pSnapshot->renewDeadlineNs = l.deadlines.renewNs;
+    pSnapshot->rebindDeadlineNs = l.deadlines.rebindNs;
+    pSnapshot->expiryDeadlineNs = l.deadlines.expiryNs;
+    pSnapshot->generation = l.generation;
+    pSnapshot->fromCache = l.fromCache;
+    return STATUS_SUCCESS;
+}
+
+int dhcp4c_get(enum DHCPC_MODULE module, const enum DHCPC_CMD *pCmds, unsigned int count, dhcp4cValue_t *pValues)
+{
+    dhcpv4c_lease_snapshot_t l;
+    int ret = STATUS_SUCCESS;
+    unsigned int i;
+
+    if (pCmds == NULL || pValues == NULL || stub_read_lease(module, &l))
+        return STATUS_FAILURE;
+
+    for (i = 0; i < count; i++) {
+        dhcp4cValue_t *pVal = &pValues[i];
+
+        pVal->status = STATUS_SUCCESS;
+        switch (pCmds[i]) {
+        case DHCPC_CMD_LEASE_TIME:         pVal->u.uValue = l.leaseTime; break;
+        case DHCPC_CMD_LEASE_TIME_REMAIN:  pVal->u.uValue = l.remainLeaseTime; break;
+        case DHCPC_CMD_RENEW_TIME_REMAIN:  pVal->u.uValue = l.remainRenewTime; break;
+        case DHCPC_CMD_REBIND_TIME_REMAIN: pVal->u.uValue = l.remainRebindTime; break;
+        case DHCPC_CMD_CONFIG_ATTEMPTS:    pVal->u.iValue = l.configAttempts; break;
+        case DHCPC_CMD_GET_IFNAME:         memcpy(pVal->u.ifName, l.ifName, sizeof(pVal->u.ifName)); break;
+        case DHCPC_CMD_FSM_STATE:          pVal->u.iValue = l.fsmState; break;
+        case DHCPC_CMD_IP_ADDR:            pVal->u.uValue = l.ipAddr; break;
+        case DHCPC_CMD_IP_MASK:            pVal->u.uValue = l.mask; break;
+        case DHCPC_CMD_DNS_SVRS:           stub_copy_list(&pVal->u.addrList, &l.dnsSvrs); break;
+        case DHCPC_CMD_DHCP_SVR:           pVal->u.uValue = l.dhcpSvr; break;
+        default:
+            pVal->status = STATUS_FAILURE;
+            ret = STATUS_FAILURE;
+            break;
+        }
+    }
+    return ret;
+}
@@ -26,6 +26,8 @@
 #ifndef _DHCP4_CLIENT_API_
 #define _DHCP4_CLIENT_API_
 
+#include <stdint.h>
+
 /**
  * @defgroup DHCPV4C_HAL DHCPV4C HAL
  *
@@ -80,15 +82,34 @@ enum DHCPC_CMD {
 /*!< Represents the different modules within the DHCPv4 client. */
 enum DHCPC_MODULE{
     DHCPC_ECM,      /*!< Embedded Cable Modem (ECM) module. */
-#if !defined (NO_MTA_FEATURE_SUPPORT)
     DHCPC_EROUTER,  /*!< Router module. */
-    DHCPC_EMTA      /*!< Embedded Multimedia Terminal Adapter (eMTA) module. */
-#else
-    DHCPC_EROUTER
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+    DHCPC_EMTA,     /*!< Embedded Multimedia Terminal Adapter (eMTA) module. */
 #endif
+    DHCPC_MODULE_MAX  /*!< Number of modules; sizes the per-module tables of the HAL. */
 };
 
+/**
+ * @brief Represents the DHCPv4 client state reported by the `*_fsm_state` getters.
+ */
+typedef enum {
+    DHCPC_STATE_RELEASED        = 1,  /*!< RELEASED or INIT_REBOOT. */
+    DHCPC_STATE_INIT_SELECTING  = 2,  /*!< INIT_SELECTING. */
+    DHCPC_STATE_REQUESTING      = 3,  /*!< REQUESTING. */
+    DHCPC_STATE_REBINDING       = 4,  /*!< REBINDING. */
+    DHCPC_STATE_BOUND           = 5,  /*!< BOUND. */
+    DHCPC_STATE_RENEWING        = 6   /*!< RENEWING or RENEW_REQUESTED. */
+} DhcpClientState;
+
 #define MAX_IPV4_ADDR_LIST_NUMBER        4  //!< Maximum number of IPv4 addresses in the list  
+#define MAX_IFNAME_LENGTH               64  //!< Size of the interface name buffer, including the terminating NUL.
+#define DHCP4C_MAX_INSTANCES            64  //!< Maximum number of concurrent DHCPv4 client instances.
+#define DHCP4C_INVALID_CTX               0  //!< Handle value that never refers to a client instance.
+#define DHCP4C_MAX_REQ_OPTIONS          32  //!< Maximum number of options in a parameter request list.
+#define DHCP4C_MAX_PATH_LENGTH         128  //!< Size of a file path buffer, including the terminating NUL.
+#define DHCP4C_LEASE_CACHE_MAGIC        0x44344C43  //!< Magic value ("D4LC") at the start of a lease cache file.
+#define DHCP4C_LEASE_CACHE_VERSION       1  //!< Layout version of `dhcp4cLeaseCache_t`.
+#define DHCP4C_LEASE_CACHE_UNVERIFIED_SEC 60  //!< Maximum lifetime of a cached lease whose age cannot be verified (wall clock not synchronized).
 
 /**********************************************************************
                 STRUCTURE DEFINITIONS
@@ -107,6 +128,137 @@ typedef struct {
 
 } ipv4AddrList_t;
 
+/**
+ * @brief Represents a consistent view of one module's current DHCP lease.
+ *
+ * All fields are taken from the same lease. Fields that a module does not provide
+ * (e.g., everything except the remaining timers for eMTA) are set to zero.
+ */
+typedef struct {
+    unsigned int leaseTime;            /*!< Offered lease time (in seconds). */
+    unsigned int remainLeaseTime;      /*!< Remaining lease time (in seconds). */
+    unsigned int remainRenewTime;      /*!< Remaining time to renewal (in seconds). */
+    unsigned int remainRebindTime;     /*!< Remaining time to rebind (in seconds). */
+    int configAttempts;                /*!< Number of configuration attempts. */
+    char ifName[MAX_IFNAME_LENGTH];    /*!< Interface name (vendor-specific), zero-terminated. */
+    int fsmState;                      /*!< DHCP client state, same values as the `*_fsm_state` getters. */
+    unsigned int ipAddr;               /*!< Leased IPv4 address. */
+    unsigned int mask;                 /*!< Subnet mask. */
+    unsigned int gw;                   /*!< Gateway IPv4 address. */
+    ipv4AddrList_t dnsSvrs;            /*!< DNS server list. */
+    unsigned int dhcpSvr;              /*!< DHCP server IPv4 address. */
+    uint64_t acquiredNs;               /*!< CLOCK_MONOTONIC time at which the lease was acquired, in nanoseconds. */
+    uint64_t renewDeadlineNs;          /*!< CLOCK_MONOTONIC T1 deadline, in nanoseconds. */
+    uint64_t rebindDeadlineNs;         /*!< CLOCK_MONOTONIC T2 deadline, in nanoseconds. */
+    uint64_t expiryDeadlineNs;         /*!< CLOCK_MONOTONIC lease expiry deadline, in nanoseconds. */
+    uint64_t generation;               /*!< Lease generation this snapshot was taken from. */
+    unsigned char fromCache;           /*!< 1 if the values come from the lease cache and are not yet confirmed by a DHCPACK. */
+} dhcp4cLeaseSnapshot_t;
+
+/**
+ * @brief Represents the result of one `enum DHCPC_CMD` query.
+ *
+ * The member of `u` that is valid depends on the command:
+ *  - `uValue`: LEASE_TIME, LEASE_TIME_REMAIN, RENEW_TIME_REMAIN, REBIND_TIME_REMAIN, IP_ADDR, IP_MASK, DHCP_SVR
+ *  - `iValue`: CONFIG_ATTEMPTS, FSM_STATE
+ *  - `ifName`: GET_IFNAME
+ *  - `addrList`: ROUTERS, DNS_SVRS
+ */
+typedef struct {
+    int status;                           /*!< STATUS_SUCCESS; STATUS_FAILURE if the command failed or is not supported by the module;
+                                               in non-blocking call mode also STATUS_STALE (last known value) or STATUS_NOT_READY (no value, `u` not written). */
+    union {
+        unsigned int uValue;              /*!< Unsigned value (times in seconds, IPv4 addresses). */
+        int iValue;                       /*!< Signed value (attempt count, FSM state). */
+        char ifName[MAX_IFNAME_LENGTH];   /*!< Interface name, zero-terminated. */
+        ipv4AddrList_t addrList;          /*!< List of IPv4 addresses. */
+    } u;                                  /*!< Value of the command. */
+} dhcp4cValue_t;
+
+/**
+ * @brief Handle of a DHCPv4 client instance.
+ *
+ * The low 16 bits hold the instance slot and the high 16 bits a reuse counter, so a handle
+ * is resolved with one array access and a handle kept after `dhcp4c_deinit()` is rejected.
+ * The reuse counter of every slot starts at 1 and skips 0 when it wraps, so no valid handle,
+ * including the one of slot 0 (`DHCPC_ECM`), equals `DHCP4C_INVALID_CTX`.
+ */
+typedef unsigned int dhcp4c_ctx_t;
+
+/**
+ * @brief Represents the configuration of a DHCPv4 client instance.
+ */
+typedef struct {
+    char ifName[MAX_IFNAME_LENGTH];  /*!< Interface the client runs on, e.g., "erouter0" or "voip0"; at most one instance per interface. */
+    char label[MAX_IFNAME_LENGTH];   /*!< Free-form instance name, e.g., "voice", "iptv" or "backup-wan". */
+} dhcp4cConfig_t;
+
+/**
+ * @brief Represents the protocol parameters of a DHCPv4 client instance.
+ */
+typedef struct {
+    unsigned char reqOptions[DHCP4C_MAX_REQ_OPTIONS];  /*!< Option codes to request (option 55). */
+    unsigned int numReqOptions;                         /*!< Number of entries in `reqOptions`. */
+    char hostName[MAX_IFNAME_LENGTH];                   /*!< Host name to send (option 12), empty for none. */
+    char vendorClass[MAX_IFNAME_LENGTH];                /*!< Vendor class identifier (option 60), empty for none. */
+    unsigned int requestedIp;                           /*!< Address to request (option 50), 0 for none. */
+    char leaseCacheFile[DHCP4C_MAX_PATH_LENGTH];        /*!< Lease cache file for INIT-REBOOT, empty to disable caching. */
+} dhcp4cParams_t;
+
+/**
+ * @brief Represents the on-disk lease cache record used for INIT-REBOOT.
+ *
+ * The file is written on every DHCPACK to a temporary file, synced and renamed over the
+ * previous one, so a crash leaves either the old or the new record.
+ *
+ * The age of the cached lease is computed from `acquiredTime` and CLOCK_REALTIME, which is
+ * only meaningful while the wall clock is synchronized (`adjtimex()` does not report
+ * `STA_UNSYNC`). If either time is unsynchronized, the lease is treated as unverified and its
+ * lifetime is clamped to `DHCP4C_LEASE_CACHE_UNVERIFIED_SEC`.
+ */
+typedef struct {
+    unsigned int magic;          /*!< `DHCP4C_LEASE_CACHE_MAGIC`. */
+    unsigned int version;        /*!< `DHCP4C_LEASE_CACHE_VERSION`. */
+    unsigned char chaddr[6];     /*!< Hardware address the lease was granted to. */
+    unsigned char reserved[2];   /*!< Reserved, set to zero. */
+    unsigned int ipAddr;         /*!< Leased IPv4 address. */
+    unsigned int mask;           /*!< Subnet mask. */
+    unsigned int gw;             /*!< Gateway IPv4 address. */
+    unsigned int dhcpSvr;        /*!< DHCP server IPv4 address. */
+    ipv4AddrList_t dnsSvrs;      /*!< DNS server list. */
+    unsigned int leaseTime;      /*!< Lease time (in seconds). */
+    unsigned int acquiredTime;   /*!< CLOCK_REALTIME seconds at which the lease was acquired; 0 if the wall clock was not synchronized at that time. */
+    unsigned int crc32;          /*!< CRC-32 of all preceding bytes. */
+} dhcp4cLeaseCache_t;
+
+/**
+ * @brief Represents one module of a parallel start plan.
+ */
+typedef struct {
+    enum DHCPC_MODULE module;     /*!< Module to start. */
+    unsigned int dependsOnMask;   /*!< Bitmask of `(1 << DHCPC_MODULE)` values that must be BOUND before this module starts; 0 for none. */
+} dhcp4cStartEntry_t;
+
+/**
+ * @brief Represents the timer statistics of the client engine.
+ */
+typedef struct {
+    unsigned long wakeups;                 /*!< Number of timer wakeups of the engine. */
+    unsigned long expirations;             /*!< Number of client timers (retransmit, T1, T2, expiry) served. */
+    unsigned int coalescingRatioX100;      /*!< `expirations` per wakeup, multiplied by 100. */
+} dhcp4cTimerStats_t;
+
+/**
+ * @brief Represents a summary of a DHCPv4 client instance, as returned by `dhcp4c_enum_instances()`.
+ */
+typedef struct {
+    dhcp4c_ctx_t ctx;                /*!< Instance handle. */
+    char ifName[MAX_IFNAME_LENGTH];  /*!< Interface the client runs on. */
+    char label[MAX_IFNAME_LENGTH];   /*!< Instance name. */
+    int fsmState;                    /*!< Current FSM state (see `DhcpClientState`). */
+    uint64_t generation;             /*!< Current lease generation. */
+} dhcp4cInstanceInfo_t;
+
 /** @} */  //END OF GROUP DHCPV4C_HAL_TYPES
 
 /**
@@ -133,6 +285,8 @@ typedef struct {
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure.
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_lease_time(unsigned int *pValue);
 
@@ -144,6 +298,10 @@ int dhcp4c_get_ert_lease_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_ert_remain_lease_time(unsigned int *pValue);
 
@@ -155,6 +313,10 @@ int dhcp4c_get_ert_remain_lease_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_ert_remain_renew_time(unsigned int *pValue);
 
@@ -166,6 +328,10 @@ int dhcp4c_get_ert_remain_renew_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_ert_remain_rebind_time(unsigned int *pValue);
 
@@ -177,6 +343,8 @@ int dhcp4c_get_ert_remain_rebind_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_config_attempts(int *pValue);
 
@@ -190,6 +358,8 @@ int dhcp4c_get_ert_config_attempts(int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., null pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_ifname(char *pName);
 
@@ -201,6 +371,8 @@ int dhcp4c_get_ert_ifname(char *pName);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * @note Possible values for `pValue`:
  *  - 1: RELEASED or INIT_REBOOT
@@ -210,7 +382,7 @@ int dhcp4c_get_ert_ifname(char *pName);
  *  - 5: BOUND
  *  - 6: RENEWING or RENEW_REQUESTED
  *
- * TODO: Consider changing `pValue` to a `DhcpClientState` enum type for improved type safety and readability.
+ * @see DhcpClientState
  */
 int dhcp4c_get_ert_fsm_state(int *pValue);
 
@@ -224,6 +396,8 @@ int dhcp4c_get_ert_fsm_state(int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_ip_addr(unsigned int *pValue);
 
@@ -235,6 +409,8 @@ int dhcp4c_get_ert_ip_addr(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_mask(unsigned int *pValue);
 
@@ -246,6 +422,8 @@ int dhcp4c_get_ert_mask(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_gw(unsigned int *pValue);
 
@@ -257,6 +435,8 @@ int dhcp4c_get_ert_gw(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_dns_svrs(ipv4AddrList_t *pList);
 
@@ -270,6 +450,8 @@ int dhcp4c_get_ert_dns_svrs(ipv4AddrList_t *pList);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ert_dhcp_svr(unsigned int *pValue);
 
@@ -281,6 +463,8 @@ int dhcp4c_get_ert_dhcp_svr(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_lease_time(unsigned int *pValue);
 
@@ -292,6 +476,10 @@ int dhcp4c_get_ecm_lease_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_ecm_remain_lease_time(unsigned int *pValue);
 
@@ -303,6 +491,10 @@ int dhcp4c_get_ecm_remain_lease_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_ecm_remain_renew_time(unsigned int *pValue);
 
@@ -314,6 +506,10 @@ int dhcp4c_get_ecm_remain_renew_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_ecm_remain_rebind_time(unsigned int *pValue);
 
@@ -325,6 +521,8 @@ int dhcp4c_get_ecm_remain_rebind_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_config_attempts(int *pValue);
 
@@ -338,6 +536,8 @@ int dhcp4c_get_ecm_config_attempts(int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., null pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_ifname(char *pName);
 
@@ -347,13 +547,13 @@ int dhcp4c_get_ecm_ifname(char *pName);
  * This function retrieves the current state of the DHCP client associated with the Embedded Cable Modem (ECM).
  *
  * @param[out] pValue - Pointer to an integer where the DHCP client state will be stored.
- *  @see `enum DHCPC_CMD` for possible values.
+ *  @see `DhcpClientState` for possible values.
  *
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
- *
- * TODO: Consider returning a `DHCPClientState` enum instead of an integer for improved type safety and clarity.
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_fsm_state(int *pValue);
 
@@ -365,6 +565,8 @@ int dhcp4c_get_ecm_fsm_state(int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  */
 int dhcp4c_get_ecm_ip_addr(unsigned int *pValue);
@@ -377,6 +579,8 @@ int dhcp4c_get_ecm_ip_addr(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_mask(unsigned int *pValue);
 
@@ -388,6 +592,8 @@ int dhcp4c_get_ecm_mask(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_gw(unsigned int *pValue);
 
@@ -399,6 +605,8 @@ int dhcp4c_get_ecm_gw(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 int dhcp4c_get_ecm_dns_svrs(ipv4AddrList_t *pList);
 
@@ -410,6 +618,8 @@ int dhcp4c_get_ecm_dns_svrs(ipv4AddrList_t *pList);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  */
 int dhcp4c_get_ecm_dhcp_svr(unsigned int *pValue);
@@ -423,6 +633,10 @@ int dhcp4c_get_ecm_dhcp_svr(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_emta_remain_lease_time(unsigned int *pValue);
 
@@ -434,6 +648,10 @@ int dhcp4c_get_emta_remain_lease_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_emta_remain_renew_time(unsigned int *pValue);
 
@@ -445,9 +663,294 @@ int dhcp4c_get_emta_remain_renew_time(unsigned int *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcp4c_get_lease_snapshot() - The remaining time is computed from the lease deadline.
  */
 int dhcp4c_get_emta_remain_rebind_time(unsigned int *pValue);
 #endif
+
+/**
+ * @brief Retrieves all lease parameters of a module in a single call.
+ *
+ * All fields are read from the same lease, so the caller never sees a mix of two leases.
+ *
+ * @param[in]  module    - Module to query (see `enum DHCPC_MODULE`).
+ * @param[out] pSnapshot - Pointer to a `dhcp4cLeaseSnapshot_t` structure to store the lease parameters.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ */
+int dhcp4c_get_lease_snapshot(enum DHCPC_MODULE module, dhcp4cLeaseSnapshot_t *pSnapshot);
+
+/**
+ * @brief Retrieves several parameters of a module in a single call.
+ *
+ * Each command is answered from the same lease. The `dhcp4c_get_<module>_*` and
+ * `dhcpv4c_get_<module>_*` getters are equivalent to calling this function with a single command.
+ * `DHCPC_CMD_ROUTERS`, which has no dedicated getter, is available only through this function.
+ *
+ * @param[in]  module  - Module to query (see `enum DHCPC_MODULE`).
+ * @param[in]  pCmds   - Array of `count` commands to answer; a command may appear more than once.
+ * @param[in]  count   - Number of entries in `pCmds` and `pValues`.
+ * @param[out] pValues - Array of `count` results; `pValues[i]` holds the result of `pCmds[i]`.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - All commands succeeded.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module) or if any
+ *                          command failed; check `status` of each entry.
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no command failed and at least one
+ *                          entry is `STATUS_NOT_READY`.
+ * @retval STATUS_STALE - Non-blocking call mode only: no command failed or is not ready, and at
+ *                          least one entry is `STATUS_STALE`.
+ */
+int dhcp4c_get(enum DHCPC_MODULE module, const enum DHCPC_CMD *pCmds, unsigned int count, dhcp4cValue_t *pValues);
+
+/**
+ * @brief Creates a DHCPv4 client instance.
+ *
+ * The instance is created stopped. Every instance supports every `enum DHCPC_CMD` query. An
+ * interface has at most one instance, and the client engine opens one socket for it.
+ *
+ * @param[in]  pConfig - Pointer to the instance configuration.
+ * @param[out] pCtx    - Pointer to store the handle of the new instance.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, `DHCP4C_MAX_INSTANCES` reached,
+ *                          interface already has a client).
+ */
+int dhcp4c_init(const dhcp4cConfig_t *pConfig, dhcp4c_ctx_t *pCtx);
+
+/**
+ * @brief Destroys a DHCPv4 client instance and releases its resources.
+ *
+ * @param[in] ctx - Handle returned by `dhcp4c_init()`.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle).
+ */
+int dhcp4c_deinit(dhcp4c_ctx_t ctx);
+
+/**
+ * @brief Retrieves the handle of the instance that serves a legacy module.
+ *
+ * The E-Router, eCM and eMTA clients are instances like any other; this function maps the
+ * `enum DHCPC_MODULE` value to their handle.
+ *
+ * @param[in]  module - Module to look up.
+ * @param[out] pCtx   - Pointer to store the handle.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, module not present on this platform).
+ */
+int dhcp4c_get_ctx(enum DHCPC_MODULE module, dhcp4c_ctx_t *pCtx);
+
+/**
+ * @brief Retrieves several parameters of a client instance in a single call.
+ *
+ * Same as `dhcp4c_get()`, for an instance handle.
+ *
+ * @param[in]  ctx     - Instance handle.
+ * @param[in]  pCmds   - Array of `count` commands to answer.
+ * @param[in]  count   - Number of entries in `pCmds` and `pValues`.
+ * @param[out] pValues - Array of `count` results.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - All commands succeeded.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer) or if any command failed.
+ * @retval STATUS_NOT_READY - Non-blocking call mode only; same rules as `dhcp4c_get()`.
+ * @retval STATUS_STALE - Non-blocking call mode only; same rules as `dhcp4c_get()`.
+ */
+int dhcp4c_ctx_get(dhcp4c_ctx_t ctx, const enum DHCPC_CMD *pCmds, unsigned int count, dhcp4cValue_t *pValues);
+
+/**
+ * @brief Retrieves all lease parameters of a client instance in a single call.
+ *
+ * Same as `dhcp4c_get_lease_snapshot()`, for an instance handle.
+ *
+ * @param[in]  ctx       - Instance handle.
+ * @param[out] pSnapshot - Pointer to a `dhcp4cLeaseSnapshot_t` structure to store the lease parameters.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ */
+int dhcp4c_ctx_get_lease_snapshot(dhcp4c_ctx_t ctx, dhcp4cLeaseSnapshot_t *pSnapshot);
+
+/**
+ * @brief Enumerates all client instances in a single call.
+ *
+ * @param[out] pList      - Array of `maxEntries` `dhcp4cInstanceInfo_t` structures to fill.
+ * @param[in]  maxEntries - Number of entries in `pList`.
+ * @param[out] pCount     - Pointer to store the number of instances.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer), or if `maxEntries` is too small;
+ *                          `*pCount` is then set to the number of instances.
+ */
+int dhcp4c_enum_instances(dhcp4cInstanceInfo_t *pList, unsigned int maxEntries, unsigned int *pCount);
+
+/**
+ * @brief Sets the protocol parameters of a client instance.
+ *
+ * Optional; must be called before `dhcp4c_start()`. The new parameters take effect on the next start.
+ *
+ * @param[in] ctx     - Instance handle.
+ * @param[in] pParams - Pointer to the parameters.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer, instance running).
+ */
+int dhcp4c_set_params(dhcp4c_ctx_t ctx, const dhcp4cParams_t *pParams);
+
+/**
+ * @brief Starts a client instance.
+ *
+ * The instance's state machine is added to the client engine and enters INIT_SELECTING.
+ * This function does not wait for a lease.
+ *
+ * @param[in] ctx - Instance handle.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, already running, interface not found).
+ */
+int dhcp4c_start(dhcp4c_ctx_t ctx);
+
+/**
+ * @brief Renews the lease of a client instance immediately instead of waiting for T1.
+ *
+ * @param[in] ctx - Instance handle; the instance must be BOUND.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, instance not BOUND).
+ */
+int dhcp4c_renew(dhcp4c_ctx_t ctx);
+
+/**
+ * @brief Stops a client instance.
+ *
+ * A bound lease is released (DHCPRELEASE) and the instance enters RELEASED.
+ *
+ * @param[in] ctx - Instance handle.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, instance not running).
+ */
+int dhcp4c_stop(dhcp4c_ctx_t ctx);
+
+/**
+ * @brief Starts several modules concurrently, honoring only the given dependencies.
+ *
+ * Each module is started as soon as every module in its `dependsOnMask` is BOUND, so independent
+ * modules run their DISCOVER/OFFER/REQUEST/ACK exchanges at the same time in the client engine.
+ * For example, on DOCSIS the E-Router and eMTA entries depend on `DHCPC_ECM`. This function
+ * returns immediately; progress is reported through the `*_fsm_state` getters and lease events.
+ *
+ * @param[in] pEntries - Array of `count` start entries.
+ * @param[in] count    - Number of entries in `pEntries`.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, duplicate module, dependency cycle,
+ *                          dependency on a module not in the plan).
+ */
+int dhcp4c_start_modules(const dhcp4cStartEntry_t *pEntries, unsigned int count);
+
+/**
+ * @brief Retrieves the time a module took to reach BOUND after it was last started.
+ *
+ * @param[in]  module - Module to query.
+ * @param[out] pMs    - Pointer to store the time from start to the first DHCPACK, in milliseconds.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, module not started or not yet BOUND).
+ */
+int dhcp4c_get_time_to_bound(enum DHCPC_MODULE module, unsigned int *pMs);
+
+/**
+ * @brief Retrieves the time a client instance took to reach BOUND after it was last started.
+ *
+ * Same as `dhcp4c_get_time_to_bound()`, for an instance handle.
+ *
+ * @param[in]  ctx - Instance handle.
+ * @param[out] pMs - Pointer to store the time from start to the first DHCPACK, in milliseconds.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer, instance not started or not yet BOUND).
+ */
+int dhcp4c_ctx_get_time_to_bound(dhcp4c_ctx_t ctx, unsigned int *pMs);
+
+/**
+ * @brief Sets the slack window within which the client engine may batch timer expirations.
+ *
+ * Coalescing only defers timers: a timer is never served before its deadline. The engine wakes
+ * at the earliest time by which a pending timer must be served, and then serves every timer
+ * whose deadline has passed. T1 and T2 may be deferred by at most the slack, never past the next
+ * deadline of the same lease. Retransmissions sit in the 100 ms timer wheel and may be deferred
+ * by at most the slack, including slot rounding, capped at 1 second (RFC 2131 section 4.1).
+ * T1, T2 and lease expiry bypass the wheel and keep their exact deadline. Lease expiry is never
+ * deferred: the engine's `timerfd` is armed for the exact expiry deadline.
+ *
+ * @param[in] slackMs - Slack window in milliseconds; 0 disables coalescing.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure.
+ */
+int dhcp4c_set_timer_slack(unsigned int slackMs);
+
+/**
+ * @brief Retrieves the timer statistics of the client engine.
+ *
+ * @param[out] pStats - Pointer to a `dhcp4cTimerStats_t` structure to store the statistics.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer).
+ */
+int dhcp4c_get_timer_stats(dhcp4cTimerStats_t *pStats);
+
+/**
+ * @brief Retrieves the pollable descriptor of the client engine.
+ *
+ * The engine runs every started instance on the thread that calls `dhcp4c_engine_dispatch()`.
+ * The descriptor becomes readable when a packet or a timer of any instance is ready.
+ *
+ * @param[out] pFd - Pointer to an integer to store the descriptor.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer).
+ */
+int dhcp4c_engine_get_fd(int *pFd);
+
+/**
+ * @brief Processes ready packets and timers of all client instances.
+ *
+ * @param[in] timeoutMs - Maximum time to wait for work, in milliseconds; 0 returns immediately
+ *                        and -1 waits until there is work.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., engine not initialized).
+ */
+int dhcp4c_engine_dispatch(int timeoutMs);
 /** @} */  //END OF GROUP DHCPV4C_HAL_APIS
 
 #endif
@@ -0,0 +1,316 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2023 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/**
+ * @file dhcp4cApi.hpp
+ * @brief Header-only C++ accessor layer for the RDK-Broadband DHCPv4 Client HAL.
+ *
+ * `dhcp4c::Dhcp4Client<Module>::get<Cmd>()` is bound at compile time to the C getter that
+ * serves the `enum DHCPC_MODULE` / `enum DHCPC_CMD` combination, so a call costs exactly one
+ * call of that getter. Combinations without a getter (e.g., `DHCPC_EMTA` with `DHCPC_CMD_IP_ADDR`)
+ * fail to compile. Requires C++11.
+ *
+ * DNS servers and routers are returned as an `AddrSpan` that points into the shared lease
+ * storage (see `dhcpv4c_get_addr_list_view()`), so lists of any length are returned without a
+ * copy. A span belongs to one lease generation; check it with `isCurrent()` after use.
+ *
+ * @code
+ * typedef dhcp4c::Dhcp4Client<DHCPC_EROUTER> Ert;
+ * DhcpClientState state;
+ * dhcp4c::AddrSpan dns;
+ * if (Ert::get<DHCPC_CMD_FSM_STATE>(state) == STATUS_SUCCESS && state == DHCPC_STATE_BOUND &&
+ *     Ert::get<DHCPC_CMD_DNS_SVRS>(dns) == STATUS_SUCCESS) {
+ *     for (unsigned int addr : dns)
+ *         use(addr);
+ *     if (!Ert::isCurrent(dns))
+ *         ...;  // the lease changed while reading; take a new span
+ * }
+ * @endcode
+ */
+#ifndef _DHCP4_CLIENT_API_HPP_
+#define _DHCP4_CLIENT_API_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+extern "C" {
+#include "dhcpv4c_api.h"
+}
+
+/**
+ * @addtogroup DHCPV4C_HAL_APIS
+ * @{
+ */
+
+namespace dhcp4c {
+
+/**
+ * @brief Selects the C function family a `Dhcp4Client` is bound to.
+ */
+enum class Api {
+    Dhcpv4c,  /*!< `dhcpv4c_get_<module>_*` functions of `dhcpv4c_api.h`. */
+    Dhcp4c    /*!< `dhcp4c_get_<module>_*` functions of `dhcp4cApi.h`. */
+};
+
+/**
+ * @brief Read-only view of an IPv4 address-list option of one lease.
+ *
+ * The addresses are in network byte order, as carried in the option. The span points into the
+ * shared lease storage and stays readable after the lease changes, but its contents belong to
+ * lease `generation()` only while the module's lease generation still has that value.
+ */
+class AddrSpan {
+public:
+    AddrSpan() : m_pData(NULL), m_size(0), m_generation(0) {}
+    AddrSpan(const unsigned int *pData, std::size_t size, uint64_t generation)
+        : m_pData(pData), m_size(size), m_generation(generation) {}
+
+    const unsigned int *begin() const { return m_pData; }
+    const unsigned int *end() const { return m_pData + m_size; }
+    const unsigned int *data() const { return m_pData; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    unsigned int operator[](std::size_t i) const { return m_pData[i]; }
+    uint64_t generation() const { return m_generation; }
+
+private:
+    const unsigned int *m_pData;
+    std::size_t m_size;
+    uint64_t m_generation;
+};
+
+namespace detail {
+
+struct Unsupported {};
+
+/* The C getters also write their output when they return STATUS_STALE. */
+inline bool hasValue(int rc) { return rc == STATUS_SUCCESS || rc == STATUS_STALE; }
+
+/* Calls a state getter whose output is `DhcpClientState` (dhcpv4c_*) or `int` (dhcp4c_*). */
+template <typename T>
+inline int callState(int (*fn)(T *), DhcpClientState &out)
+{
+    T value = T();
+    int rc = fn(&value);
+    if (hasValue(rc))
+        out = static_cast<DhcpClientState>(value);
+    return rc;
+}
+
+/* Primary template: the combination has no C getter. */
+template <DHCPC_MODULE Module, DHCPC_CMD Cmd, Api A>
+struct Binding {
+    static const bool supported = false;
+    typedef Unsupported result_type;
+    static int call(result_type &) { return STATUS_FAILURE; }
+};
+
+template <DHCPC_MODULE Module, Api A>
+struct GatewayBinding {
+    static const bool supported = false;
+    static int call(unsigned int &) { return STATUS_FAILURE; }
+};
+
+#define DHCP4C_HPP_BIND_VALUE(MOD, CMD, API, TYPE, FN)                          \
+    template <> struct Binding<MOD, CMD, API> {                                 \
+        static const bool supported = true;                                     \
+        typedef TYPE result_type;                                               \
+        static int call(result_type &out)                                       \
+        {                                                                       \
+            result_type value = result_type();                                  \
+            int rc = FN(&value);                                                \
+            if (hasValue(rc))                                                   \
+                out = value;                                                    \
+            return rc;                                                          \
+        }                                                                       \
+    };
+
+#define DHCP4C_HPP_BIND_STATE(MOD, API, FN)                                     \
+    template <> struct Binding<MOD, DHCPC_CMD_FSM_STATE, API> {                 \
+        static const bool supported = true;                                     \
+        typedef DhcpClientState result_type;                                    \
+        static int call(result_type &out) { return callState(FN, out); }        \
+    };
+
+#define DHCP4C_HPP_BIND_IFNAME(MOD, API, FN)                                    \
+    template <> struct Binding<MOD, DHCPC_CMD_GET_IFNAME, API> {                \
+        static const bool supported = true;                                     \
+        typedef std::string result_type;                                        \
+        static int call(result_type &out)                                       \
+        {                                                                       \
+            char name[MAX_IFNAME_LENGTH] = {0};                                 \
+            int rc = FN(name);                                                  \
+            if (hasValue(rc))                                                   \
+                out.assign(name, strnlen(name, sizeof(name)));                  \
+            return rc;                                                          \
+        }                                                                       \
+    };
+
+/*
+ * Address lists are served by dhcpv4c_get_addr_list_view() for both function families: the
+ * per-field getters and dhcp4c_get() copy at most four addresses, and DHCPC_CMD_ROUTERS has no
+ * per-field getter.
+ */
+#define DHCP4C_HPP_BIND_ADDRS(MOD, CMD, API, OPTION)                            \
+    template <> struct Binding<MOD, CMD, API> {                                 \
+        static const bool supported = true;                                     \
+        typedef AddrSpan result_type;                                           \
+        static int call(result_type &out)                                       \
+        {                                                                       \
+            dhcpv4c_addr_list_view_t view;                                      \
+            int rc = dhcpv4c_get_addr_list_view(MOD, OPTION, &view);            \
+            if (rc == STATUS_SUCCESS)                                           \
+                out = AddrSpan(view.pAddrs, view.number, view.generation);      \
+            return rc;                                                          \
+        }                                                                       \
+    };
+
+#define DHCP4C_HPP_BIND_GATEWAY(MOD, API, FN)                                   \
+    template <> struct GatewayBinding<MOD, API> {                               \
+        static const bool supported = true;                                     \
+        static int call(unsigned int &out)                                      \
+        {                                                                       \
+            unsigned int value = 0;                                             \
+            int rc = FN(&value);                                                \
+            if (hasValue(rc))                                                   \
+                out = value;                                                    \
+            return rc;                                                          \
+        }                                                                       \
+    };
+
+#define DHCP4C_HPP_BIND_FULL(MOD, API, PFX)                                                                  \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_LEASE_TIME, API, unsigned int, PFX##_lease_time)                   \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_LEASE_TIME_REMAIN, API, unsigned int, PFX##_remain_lease_time)     \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_RENEW_TIME_REMAIN, API, unsigned int, PFX##_remain_renew_time)     \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_REBIND_TIME_REMAIN, API, unsigned int, PFX##_remain_rebind_time)   \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_CONFIG_ATTEMPTS, API, int, PFX##_config_attempts)                  \
+    DHCP4C_HPP_BIND_IFNAME(MOD, API, PFX##_ifname)                                                          \
+    DHCP4C_HPP_BIND_STATE(MOD, API, PFX##_fsm_state)                                                        \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_IP_ADDR, API, unsigned int, PFX##_ip_addr)                         \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_IP_MASK, API, unsigned int, PFX##_mask)                            \
+    DHCP4C_HPP_BIND_ADDRS(MOD, DHCPC_CMD_ROUTERS, API, DHCPV4C_OPTION_ROUTERS)                               \
+    DHCP4C_HPP_BIND_ADDRS(MOD, DHCPC_CMD_DNS_SVRS, API, DHCPV4C_OPTION_DNS_SVRS)                            \
+    DHCP4C_HPP_BIND_VALUE(MOD, DHCPC_CMD_DHCP_SVR, API, unsigned int, PFX##_dhcp_svr)                       \
+    DHCP4C_HPP_BIND_GATEWAY(MOD, API, PFX##_gw)
+
+DHCP4C_HPP_BIND_FULL(DHCPC_EROUTER, Api::Dhcpv4c, dhcpv4c_get_ert)
+DHCP4C_HPP_BIND_FULL(DHCPC_ECM, Api::Dhcpv4c, dhcpv4c_get_ecm)
+DHCP4C_HPP_BIND_FULL(DHCPC_EROUTER, Api::Dhcp4c, dhcp4c_get_ert)
+DHCP4C_HPP_BIND_FULL(DHCPC_ECM, Api::Dhcp4c, dhcp4c_get_ecm)
+
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+DHCP4C_HPP_BIND_VALUE(DHCPC_EMTA, DHCPC_CMD_LEASE_TIME_REMAIN, Api::Dhcpv4c, unsigned int, dhcpv4c_get_emta_remain_lease_time)
+DHCP4C_HPP_BIND_VALUE(DHCPC_EMTA, DHCPC_CMD_RENEW_TIME_REMAIN, Api::Dhcpv4c, unsigned int, dhcpv4c_get_emta_remain_renew_time)
+DHCP4C_HPP_BIND_VALUE(DHCPC_EMTA, DHCPC_CMD_REBIND_TIME_REMAIN, Api::Dhcpv4c, unsigned int, dhcpv4c_get_emta_remain_rebind_time)
+DHCP4C_HPP_BIND_VALUE(DHCPC_EMTA, DHCPC_CMD_LEASE_TIME_REMAIN, Api::Dhcp4c, unsigned int, dhcp4c_get_emta_remain_lease_time)
+DHCP4C_HPP_BIND_VALUE(DHCPC_EMTA, DHCPC_CMD_RENEW_TIME_REMAIN, Api::Dhcp4c, unsigned int, dhcp4c_get_emta_remain_renew_time)
+DHCP4C_HPP_BIND_VALUE(DHCPC_EMTA, DHCPC_CMD_REBIND_TIME_REMAIN, Api::Dhcp4c, unsigned int, dhcp4c_get_emta_remain_rebind_time)
+#endif
+
+#undef DHCP4C_HPP_BIND_FULL
+#undef DHCP4C_HPP_BIND_GATEWAY
+#undef DHCP4C_HPP_BIND_ADDRS
+#undef DHCP4C_HPP_BIND_IFNAME
+#undef DHCP4C_HPP_BIND_STATE
+#undef DHCP4C_HPP_BIND_VALUE
+
+} // namespace detail
+
+/**
+ * @brief Compile-time bound accessor for one DHCPv4 client module.
+ *
+ * @tparam Module - Module to access (see `enum DHCPC_MODULE`).
+ * @tparam A      - C function family to call; defaults to the `dhcpv4c_*` functions.
+ */
+template <DHCPC_MODULE Module, Api A = Api::Dhcpv4c>
+class Dhcp4Client {
+public:
+    /** Result type of `get<Cmd>()`. */
+    template <DHCPC_CMD Cmd>
+    struct Result {
+        typedef typename detail::Binding<Module, Cmd, A>::result_type type;
+    };
+
+    /** true if `get<Cmd>()` is available for this module. */
+    template <DHCPC_CMD Cmd>
+    static constexpr bool supports() { return detail::Binding<Module, Cmd, A>::supported; }
+
+    /**
+     * @brief Retrieves one lease parameter.
+     *
+     * @param[out] out - Receives the value; left unchanged unless the call returns
+     *                   `STATUS_SUCCESS` or `STATUS_STALE`.
+     *
+     * @returns Status of the operation:
+     * @retval STATUS_SUCCESS - On success.
+     * @retval STATUS_FAILURE - On failure (e.g., retrieval error).
+     * @retval STATUS_STALE - Non-blocking call mode only: `out` holds the last known value.
+     * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet.
+     */
+    template <DHCPC_CMD Cmd, typename T>
+    static int get(T &out)
+    {
+        static_assert(detail::Binding<Module, Cmd, A>::supported,
+                      "DHCPC_CMD is not supported for this DHCPC_MODULE");
+        static_assert(std::is_same<T, typename Result<Cmd>::type>::value,
+                      "output argument does not match Result<Cmd>::type");
+        return detail::Binding<Module, Cmd, A>::call(out);
+    }
+
+    /**
+     * @brief Retrieves the gateway IPv4 address.
+     *
+     * @param[out] out - Receives the address; left unchanged unless the call returns
+     *                   `STATUS_SUCCESS` or `STATUS_STALE`.
+     *
+     * @returns Status of the operation:
+     * @retval STATUS_SUCCESS - On success.
+     * @retval STATUS_FAILURE - On failure (e.g., retrieval error).
+     * @retval STATUS_STALE - Non-blocking call mode only: `out` holds the last known value.
+     * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet.
+     */
+    static int gateway(unsigned int &out)
+    {
+        static_assert(detail::GatewayBinding<Module, A>::supported,
+                      "gateway is not supported for this DHCPC_MODULE");
+        return detail::GatewayBinding<Module, A>::call(out);
+    }
+
+    /**
+     * @brief Checks whether an address span still belongs to the module's current lease.
+     *
+     * @param[in] span - Span returned by `get<DHCPC_CMD_DNS_SVRS>()` or `get<DHCPC_CMD_ROUTERS>()`.
+     *
+     * @returns true if the module's lease generation still equals `span.generation()`.
+     */
+    static bool isCurrent(const AddrSpan &span)
+    {
+        uint64_t generation = 0;
+        return dhcpv4c_get_lease_generation(Module, &generation) == STATUS_SUCCESS &&
+               generation == span.generation();
+    }
+};
+
+} // namespace dhcp4c
+
+/** @} */  //END OF GROUP DHCPV4C_HAL_APIS
+
+#endif
@@ -70,11 +70,64 @@
 #define STATUS_FAILURE     -1
 #endif
 
+#ifndef STATUS_STALE
+#define STATUS_STALE       1   //!< Non-blocking mode only: the last known value was returned, a refresh is in progress.
+#endif
+
+#ifndef STATUS_NOT_READY
+#define STATUS_NOT_READY   2   //!< Non-blocking mode only: no value is known yet, a refresh is in progress.
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dhcp4cApi.h"
+
 /**
  * @addtogroup DHCPV4C_HAL_TYPES
  * @{
  */
 #define DHCPV4_MAX_IPV4_ADDRS   4
+#define DHCPV4_MAX_IFNAME_LEN   64  //!< Size of the interface name buffer, including the terminating NUL.
+
+#define DHCPV4C_BACKEND_OPS_VERSION  1  //!< Current `dhcpv4c_backend_ops_t.version`.
+
+#define DHCPV4C_LEASE_SHM_NAME     "/dhcpv4c_lease"  //!< POSIX shared-memory object holding the published leases.
+#define DHCPV4C_LEASE_SHM_MAGIC    0x44344C53        //!< Magic value ("D4LS") at the start of the segment.
+#define DHCPV4C_LEASE_SHM_VERSION  1                 //!< Layout version of `dhcpv4c_lease_shm_t`.
+
+/** Fails the build if `expr` is false; used to pin the shared-memory layout on every ABI. */
+#define DHCPV4C_LAYOUT_CHECK(name, expr)  typedef char dhcpv4c_layout_check_##name[(expr) ? 1 : -1]
+
+#define DHCPV4C_UDHCPC_STATE_DIR   "/tmp/udhcpc"  //!< Directory holding the `<ifname>.lease` files written for the open-source backend.
+
+#define DHCPV4C_OPTION_ROUTERS      3   //!< DHCP option code of the router list.
+#define DHCPV4C_OPTION_DNS_SVRS     6   //!< DHCP option code of the DNS server list.
+#define DHCPV4C_OPTION_NTP_SVRS     42  //!< DHCP option code of the NTP server list.
+
+#define DHCPV4C_MAX_OPTION_CODES    256     //!< Number of DHCP option codes (0-255).
+#define DHCPV4C_OPTION_ABSENT       0xFFFF  //!< `dhcpv4c_option_index_t.offset` value of an option not present in the lease.
+#define DHCPV4C_MAX_OPTION_DATA     1536    //!< Size in bytes of the payload storage of one option area; also the maximum length of one stored option.
+
+#if DHCPV4C_MAX_OPTION_DATA >= DHCPV4C_OPTION_ABSENT
+#error "DHCPV4C_MAX_OPTION_DATA must be below DHCPV4C_OPTION_ABSENT so that every offset fits in dhcpv4c_option_index_t"
+#endif
+
+#define DHCPV4C_STATS_LATENCY_BUCKETS  16  //!< Number of log2 latency buckets; bucket `i` counts calls that took [2^i, 2^(i+1)) microseconds.
+#define DHCPV4C_STATS_LOG_FILE  "/rdklogs/logs/dhcp_vendor_hal_stats.log"  //!< Default output of `dhcpv4c_dump_stats()`.
+
+#define DHCPV4C_FSM_HISTORY_DEPTH   32  //!< Number of FSM transitions kept per client instance.
+#define DHCPV4C_FSM_STATE_COUNT     (DHCPC_STATE_RENEWING + 1)  //!< Size of arrays indexed by `DhcpClientState`; entry 0 is unused.
+
+#define DHCPV4C_SRV_MAC_LEN         6   //!< Length of a client hardware (MAC) address.
+#define DHCPV4C_SRV_JOURNAL_MAGIC   0x44344A4C  //!< Magic value ("D4JL") at the start of the lease journal.
+#define DHCPV4C_SRV_SNAPSHOT_MAGIC  0x44345353  //!< Magic value ("D4SS") at the start of the lease snapshot.
+#define DHCPV4C_SRV_JOURNAL_VERSION 1           //!< Layout version of the journal and snapshot files.
+#define DHCPV4C_SRV_UNVERIFIED_LEASE_SEC 86400  //!< Maximum remaining time given to a replayed lease whose expiry cannot be verified (wall clock not synchronized).
+
+#define DHCPV4C_EVENT_STATE_CHANGE  0x01  //!< Client FSM state changed (e.g., BOUND, RENEWING, REBINDING, RELEASED).
+#define DHCPV4C_EVENT_PARAM_CHANGE  0x02  //!< Lease parameters (IP address, mask, gateway, DNS, timers) changed.
+#define DHCPV4C_EVENT_ALL           0x03  //!< All lease events.
+#define DHCPV4C_EVENT_OVERFLOW      0x80  //!< Events were dropped; re-read the lease with `dhcpv4c_get_lease_snapshot()`.
 
 /**********************************************************************
                 STRUCTURE DEFINITIONS
@@ -84,6 +137,451 @@ typedef struct {
     INT  number;  /*!< Number of IPv4 addresses in the list. */
     UINT addrs[DHCPV4_MAX_IPV4_ADDRS];  /*!< Array storing IPv4 addresses (e.g., "192.168.0.1"). */ 
 } dhcpv4c_ip_list_t;
+
+/**
+ * @brief Represents the absolute deadlines of a lease.
+ *
+ * All times are CLOCK_MONOTONIC in nanoseconds, so a caller can compute the remaining time
+ * locally as `deadline - now` without querying the HAL again. A zero value means the deadline is
+ * not set (e.g., no lease is bound).
+ */
+typedef struct {
+    uint64_t acquiredNs;  /*!< Time at which the lease was acquired (DHCPACK received). */
+    uint64_t renewNs;     /*!< T1: time at which the client enters RENEWING. */
+    uint64_t rebindNs;    /*!< T2: time at which the client enters REBINDING. */
+    uint64_t expiryNs;    /*!< Time at which the lease expires. */
+} dhcpv4c_lease_deadlines_t;
+
+/**
+ * @brief Represents a consistent view of one module's current DHCP lease.
+ *
+ * All fields are taken from the same lease, so the IP address, mask, gateway and DNS servers
+ * always belong together. Fields that a module does not provide (e.g., everything except the
+ * remaining timers for eMTA) are set to zero.
+ */
+typedef struct {
+    UINT leaseTime;                     /*!< Offered lease time (in seconds). */
+    UINT remainLeaseTime;               /*!< Remaining lease time (in seconds). */
+    UINT remainRenewTime;               /*!< Remaining time to renewal (in seconds). */
+    UINT remainRebindTime;              /*!< Remaining time to rebind (in seconds). */
+    INT  configAttempts;                /*!< Number of configuration attempts. */
+    CHAR ifName[DHCPV4_MAX_IFNAME_LEN]; /*!< Interface name (vendor-specific), zero-terminated. */
+    INT  fsmState;                      /*!< DHCP client state, same values as the `*_fsm_state` getters. */
+    UINT ipAddr;                        /*!< Leased IPv4 address. */
+    UINT mask;                          /*!< Subnet mask. */
+    UINT gw;                            /*!< Gateway IPv4 address. */
+    dhcpv4c_ip_list_t dnsSvrs;          /*!< DNS server list. */
+    UINT dhcpSvr;                       /*!< DHCP server IPv4 address. */
+    UINT reserved1;                     /*!< Reserved, set to zero; keeps `deadlines` 8-byte aligned. */
+    dhcpv4c_lease_deadlines_t deadlines; /*!< Absolute lease deadlines. */
+    uint64_t generation;                /*!< Lease generation this snapshot was taken from. */
+    BOOL fromCache;                     /*!< TRUE if the values come from the lease cache and are not yet confirmed by a DHCPACK. */
+    UCHAR reserved2[7];                 /*!< Reserved, set to zero; pads the structure to a multiple of 8 bytes. */
+} dhcpv4c_lease_snapshot_t;
+
+/**
+ * @brief Cause of a client FSM transition.
+ */
+typedef enum {
+    DHCPV4C_CAUSE_NONE,           /*!< Unknown or not applicable. */
+    DHCPV4C_CAUSE_START,          /*!< Client started. */
+    DHCPV4C_CAUSE_STOP,           /*!< Client stopped or lease released. */
+    DHCPV4C_CAUSE_OFFER,          /*!< DHCPOFFER accepted. */
+    DHCPV4C_CAUSE_ACK,            /*!< DHCPACK received. */
+    DHCPV4C_CAUSE_NAK,            /*!< DHCPNAK received. */
+    DHCPV4C_CAUSE_TIMEOUT,        /*!< T1, T2 or lease expiry reached, or retransmissions exhausted. */
+    DHCPV4C_CAUSE_LINK_DOWN,      /*!< Link went down. */
+    DHCPV4C_CAUSE_LINK_UP,        /*!< Link came up. */
+    DHCPV4C_CAUSE_RENEW_REQUEST   /*!< Renewal requested by the caller. */
+} dhcpv4c_fsm_cause_t;
+
+/**
+ * @brief Represents one client FSM transition.
+ */
+typedef struct {
+    uint64_t timestampNs;       /*!< CLOCK_MONOTONIC time of the transition, in nanoseconds. */
+    UCHAR fromState;            /*!< Previous state (see `DhcpClientState`). */
+    UCHAR toState;              /*!< New state (see `DhcpClientState`). */
+    UCHAR cause;                /*!< Cause (see `dhcpv4c_fsm_cause_t`). */
+    UCHAR retransmits;          /*!< Number of retransmissions made in the previous state. */
+    UCHAR reserved[4];          /*!< Reserved, set to zero; pads the structure to 16 bytes on every ABI. */
+} dhcpv4c_fsm_transition_t;
+
+/**
+ * @brief Represents aggregated FSM metrics of a client instance since it was created.
+ */
+typedef struct {
+    UINT timeToBoundMs;         /*!< Time from the last start to the first DHCPACK (ms), 0 if not yet BOUND. */
+    UINT renewCount;            /*!< Number of renewals attempted (BOUND to RENEWING). */
+    UINT renewSuccessCount;     /*!< Number of renewals answered with DHCPACK. */
+    UINT renewLatencyAvgMs;     /*!< Average time from RENEWING to DHCPACK (ms). */
+    UINT renewLatencyMaxMs;     /*!< Maximum time from RENEWING to DHCPACK (ms). */
+    UINT rebindCount;           /*!< Number of times REBINDING was entered. */
+    UINT nakCount;              /*!< Number of DHCPNAKs received. */
+    UINT expiryCount;           /*!< Number of leases that expired. */
+    uint64_t timeInStateMs[DHCPV4C_FSM_STATE_COUNT];  /*!< Total time spent in each state (ms), indexed by `DhcpClientState`; entry 0 is unused. */
+} dhcpv4c_fsm_metrics_t;
+
+/**
+ * @brief Represents one client instance's FSM history in the shared-memory segment.
+ *
+ * Written only by the client engine. The writer and readers use `seq` in the same way as
+ * `dhcpv4c_lease_record_t`.
+ */
+typedef struct {
+    volatile uint32_t seq;                                            /*!< Sequence counter, odd while the history is being written. */
+    uint32_t head;                                                    /*!< Total number of transitions recorded; the newest is at `(head - 1) % DHCPV4C_FSM_HISTORY_DEPTH`. */
+    dhcpv4c_fsm_metrics_t metrics;                                    /*!< Aggregated metrics. */
+    dhcpv4c_fsm_transition_t entries[DHCPV4C_FSM_HISTORY_DEPTH];      /*!< Ring buffer of transitions. */
+} dhcpv4c_fsm_history_t;
+
+/**
+ * @brief Represents the location of one option's payload in the stored options.
+ *
+ * A stored payload lies entirely within the `DHCPV4C_MAX_OPTION_DATA` bytes of its option area,
+ * so `offset` and `length` are both below `DHCPV4C_MAX_OPTION_DATA`, which is below
+ * `DHCPV4C_OPTION_ABSENT`. This also holds for a split option (RFC 3396) whose concatenated
+ * payload is longer than 255 bytes.
+ */
+typedef struct {
+    unsigned short offset;  /*!< Offset of the payload in `dhcpv4c_options_view_t.pData`, or `DHCPV4C_OPTION_ABSENT`. */
+    unsigned short length;  /*!< Length of the payload in bytes (may be 0, e.g., option 80). */
+} dhcpv4c_option_index_t;
+
+/**
+ * @brief Represents one option area of a client instance in the shared-memory segment.
+ *
+ * Holds the options of one lease. Each payload starts at a 4-byte aligned offset of `data`,
+ * so an IPv4 address-list payload can be read in place as an array of `UINT` in network byte
+ * order.
+ */
+typedef struct {
+    uint64_t generation;                                /*!< Lease generation whose options the area holds. */
+    uint32_t dataLen;                                   /*!< Number of bytes of `data` in use. */
+    uint32_t truncated;                                 /*!< Non-zero if options were dropped because `data` was full. */
+    dhcpv4c_option_index_t index[DHCPV4C_MAX_OPTION_CODES];  /*!< Location of each option, indexed by option code. */
+    UCHAR data[DHCPV4C_MAX_OPTION_DATA];                /*!< Option payloads. */
+} dhcpv4c_option_area_t;
+
+/**
+ * @brief Represents the double-buffered option storage of a client instance.
+ *
+ * `dhcpv4c_publish_lease()` writes a new lease's options into the area that is not active, sets
+ * that area's `generation`, flips `active` and only then publishes the lease record. A reader
+ * uses `areas[active]` only if its `generation` equals the record's generation.
+ */
+typedef struct {
+    volatile uint32_t active;         /*!< Index (0 or 1) of the area holding the current lease. */
+    uint32_t reserved;                /*!< Reserved, set to zero. */
+    dhcpv4c_option_area_t areas[2];   /*!< The two option areas, used alternately. */
+} dhcpv4c_option_store_t;
+
+/**
+ * @brief Represents one module's lease record in the shared-memory segment.
+ *
+ * The writer increments `seq` to an odd value, updates the record and increments `seq` again.
+ * A reader copies the record and retries if `seq` was odd or changed during the copy.
+ */
+typedef struct {
+    volatile uint32_t seq;           /*!< Sequence counter, odd while the record is being written. */
+    uint32_t reserved;               /*!< Reserved, set to zero; keeps `generation` 8-byte aligned. */
+    volatile uint64_t generation;    /*!< Lease generation, readable without the sequence counter. */
+    uint64_t updatedNs;              /*!< CLOCK_MONOTONIC time at which the record was written, in nanoseconds. */
+    dhcpv4c_lease_snapshot_t lease;  /*!< Lease parameters; readers derive remaining times from `lease.deadlines`. */
+} dhcpv4c_lease_record_t;
+
+/**
+ * @brief Layout of the `DHCPV4C_LEASE_SHM_NAME` shared-memory segment.
+ *
+ * The segment is writable only by the process that owns the DHCPv4 clients and is mapped
+ * read-only by every other process, which may have been built for a different ABI (e.g., a
+ * 32-bit process on a 64-bit platform). All members therefore use fixed-width types, and every
+ * structure in the segment carries explicit `reserved` members so that each `uint64_t` sits at an
+ * 8-byte offset and no structure has implicit padding; the layout checks below fail the build if
+ * that stops being true. A reader refuses the segment unless `magic`, `version` and `size` all
+ * match its own build.
+ */
+typedef struct {
+    uint32_t magic;                                    /*!< `DHCPV4C_LEASE_SHM_MAGIC`. */
+    uint32_t version;                                  /*!< `DHCPV4C_LEASE_SHM_VERSION`. */
+    uint32_t size;                                     /*!< `sizeof(dhcpv4c_lease_shm_t)` as seen by the writer. */
+    uint32_t reserved;                                 /*!< Reserved, set to zero. */
+    uint64_t generationBase;                           /*!< CLOCK_BOOTTIME in nanoseconds when the segment was created; first generation of every slot. */
+    dhcpv4c_lease_record_t records[DHCP4C_MAX_INSTANCES];  /*!< One record per client instance slot; legacy modules use slot `enum DHCPC_MODULE`. */
+    dhcpv4c_fsm_history_t histories[DHCP4C_MAX_INSTANCES];  /*!< FSM history of each client instance slot. */
+    dhcpv4c_option_store_t options[DHCP4C_MAX_INSTANCES];   /*!< DHCP options of each client instance slot. */
+} dhcpv4c_lease_shm_t;
+
+DHCPV4C_LAYOUT_CHECK(snapshot_deadlines, offsetof(dhcpv4c_lease_snapshot_t, deadlines) == 128);
+DHCPV4C_LAYOUT_CHECK(snapshot_generation, offsetof(dhcpv4c_lease_snapshot_t, generation) == 160);
+DHCPV4C_LAYOUT_CHECK(snapshot_size, sizeof(dhcpv4c_lease_snapshot_t) == 176);
+DHCPV4C_LAYOUT_CHECK(record_lease, offsetof(dhcpv4c_lease_record_t, lease) == 24);
+DHCPV4C_LAYOUT_CHECK(record_size, sizeof(dhcpv4c_lease_record_t) == 200);
+DHCPV4C_LAYOUT_CHECK(metrics_size, sizeof(dhcpv4c_fsm_metrics_t) == 88);
+DHCPV4C_LAYOUT_CHECK(transition_size, sizeof(dhcpv4c_fsm_transition_t) == 16);
+DHCPV4C_LAYOUT_CHECK(history_entries, offsetof(dhcpv4c_fsm_history_t, entries) == 96);
+DHCPV4C_LAYOUT_CHECK(history_size, sizeof(dhcpv4c_fsm_history_t) == 608);
+DHCPV4C_LAYOUT_CHECK(option_area_size, sizeof(dhcpv4c_option_area_t) == 2576);
+DHCPV4C_LAYOUT_CHECK(option_store_size, sizeof(dhcpv4c_option_store_t) == 5160);
+DHCPV4C_LAYOUT_CHECK(shm_records, offsetof(dhcpv4c_lease_shm_t, records) == 24);
+DHCPV4C_LAYOUT_CHECK(shm_size, sizeof(dhcpv4c_lease_shm_t) == 381976);
+
+/**
+ * @brief Represents a read-only view of an IPv4 address-list option in the stored lease.
+ *
+ * The view points directly at the option payload in the instance's active option area
+ * (`dhcpv4c_option_area_t`) and is not limited to `DHCPV4_MAX_IPV4_ADDRS` entries. It stays readable after the lease changes, but its contents
+ * are only guaranteed to belong to lease `generation` while `dhcpv4c_get_lease_generation()`
+ * still returns that value.
+ */
+typedef struct {
+    const UINT *pAddrs;  /*!< Array of `number` IPv4 addresses in network byte order, as carried in the option. */
+    UINT number;         /*!< Number of addresses in the option. */
+    uint64_t generation; /*!< Lease generation the view was taken from. */
+} dhcpv4c_addr_list_view_t;
+
+/**
+ * @brief Represents a read-only, indexed view of all DHCP options of a module's current lease.
+ *
+ * `pData` holds the option payloads of the DHCPACK, with split options (RFC 3396) already
+ * concatenated and the `sname`/`file` overload (option 52) already resolved. `pIndex` has one
+ * entry per option code and is built once per lease. Both point into the instance's active
+ * `dhcpv4c_option_area_t`. The view follows the same generation rules as
+ * `dhcpv4c_addr_list_view_t`.
+ */
+typedef struct {
+    const UCHAR *pData;                   /*!< Stored option payloads. */
+    UINT dataLen;                         /*!< Size of `pData` in bytes, at most `DHCPV4C_MAX_OPTION_DATA`. */
+    const dhcpv4c_option_index_t *pIndex; /*!< Array of `DHCPV4C_MAX_OPTION_CODES` entries, indexed by option code. */
+    uint64_t generation;                  /*!< Lease generation the view was taken from. */
+    BOOL truncated;                       /*!< TRUE if options of the lease were dropped because the option area was full. */
+} dhcpv4c_options_view_t;
+
+/**
+ * @brief Selects how getters behave when the underlying data is not available immediately.
+ */
+typedef enum {
+    DHCPV4C_CALL_MODE_BLOCKING,     /*!< Getters wait until the data is available (default). */
+    DHCPV4C_CALL_MODE_NONBLOCKING   /*!< Getters return within the configured deadline with `STATUS_STALE` or `STATUS_NOT_READY`. */
+} dhcpv4c_call_mode_t;
+
+/**
+ * @brief Represents a lease event delivered to subscribers.
+ */
+typedef struct {
+    enum DHCPC_MODULE module;   /*!< Module the event belongs to; `DHCPC_MODULE_MAX` for an instance that is not a legacy module. */
+    dhcp4c_ctx_t ctx;           /*!< Handle of the instance the event belongs to. */
+    UINT type;                  /*!< Bitmask of `DHCPV4C_EVENT_*` values. */
+    INT  oldState;              /*!< Previous FSM state (see `DhcpClientState`). */
+    INT  newState;              /*!< Current FSM state (see `DhcpClientState`). */
+    uint64_t timestampNs;       /*!< CLOCK_MONOTONIC time at which the event occurred, in nanoseconds. */
+} dhcpv4c_lease_event_t;
+
+/**
+ * @brief Callback invoked for each lease event.
+ *
+ * @param[in] pEvent    - Pointer to the event; valid only for the duration of the call.
+ * @param[in] pUserData - User data passed to `dhcpv4c_register_lease_event_cb()`.
+ */
+typedef void (*dhcpv4c_lease_event_cb_t)(const dhcpv4c_lease_event_t *pEvent, void *pUserData);
+
+/**
+ * @brief Represents the call statistics of one HAL API in the calling process.
+ *
+ * Bucket 0 also counts calls shorter than 1 microsecond and the last bucket also counts
+ * all longer calls.
+ */
+typedef struct {
+    const CHAR *pApiName;                              /*!< API name, e.g., "dhcpv4c_get_ert_dns_svrs" (static storage). */
+    ULONG calls;                                       /*!< Number of calls. */
+    ULONG errors;                                      /*!< Number of calls that returned a failure. */
+    ULONG latency[DHCPV4C_STATS_LATENCY_BUCKETS];      /*!< Histogram of the total call latency. */
+    ULONG backendLatency[DHCPV4C_STATS_LATENCY_BUCKETS]; /*!< Histogram of the time spent in the backend function. */
+} dhcpv4c_api_stats_t;
+
+/**
+ * @brief Represents the configuration of the DHCPv4 server.
+ */
+typedef struct {
+    CHAR ifName[DHCPV4_MAX_IFNAME_LEN];  /*!< LAN interface to serve, e.g., "brlan0". */
+    UINT serverIp;                       /*!< Server IPv4 address (option 54). */
+    UINT mask;                           /*!< Subnet mask handed to clients (option 1). */
+    UINT gw;                             /*!< Router handed to clients (option 3). */
+    dhcpv4c_ip_list_t dnsSvrs;           /*!< DNS servers handed to clients (option 6). */
+    UINT leaseTime;                      /*!< Default lease time (in seconds). */
+    UINT maxLeases;                      /*!< Expected maximum number of leases; sizes the lease table. */
+    UINT expiryBatch;                    /*!< Maximum number of leases reclaimed per expiry tick; 0 for the default (256). */
+    UINT expiryQueueLen;                 /*!< Capacity of the queue of reclaimed leases read with `dhcpv4c_srv_read_expired()`; 0 for the default (1024). */
+    CHAR journalDir[DHCP4C_MAX_PATH_LENGTH]; /*!< Directory for the lease journal and snapshot; empty disables persistence. */
+    UINT fsyncIntervalMs;                /*!< Maximum time a journal record may stay unsynced, in milliseconds; 0 for the default (1000). */
+    UINT fsyncBatch;                     /*!< Number of journal records that triggers an early fsync; 0 for the default (64). */
+    UINT ioBatch;                        /*!< Maximum packets received or sent per system call; 0 for the default (32). */
+    UINT bufferCount;                    /*!< Number of preallocated packet buffers; 0 for the default (4 x `ioBatch`). */
+} dhcpv4c_srv_config_t;
+
+/**
+ * @brief Represents one lease granted by the DHCPv4 server.
+ */
+typedef struct {
+    UCHAR mac[DHCPV4C_SRV_MAC_LEN];  /*!< Client hardware address. */
+    BOOL  isStatic;                  /*!< TRUE for a binding added with `dhcpv4c_srv_add_client()`. */
+    UCHAR reserved;                  /*!< Reserved, set to zero. */
+    UINT  ipAddr;                    /*!< Leased IPv4 address. */
+    UINT  leaseTime;                 /*!< Granted lease time (in seconds). */
+    uint64_t expiryNs;               /*!< CLOCK_MONOTONIC expiry time in nanoseconds; zero for a static binding without an active lease. */
+} dhcpv4c_srv_lease_t;
+
+/**
+ * @brief Operation recorded in a lease journal record.
+ */
+typedef enum {
+    DHCPV4C_SRV_JOURNAL_GRANT = 1,     /*!< Lease granted or renewed. */
+    DHCPV4C_SRV_JOURNAL_RELEASE,       /*!< Lease released by the client. */
+    DHCPV4C_SRV_JOURNAL_EXPIRE,        /*!< Lease expired and reclaimed. */
+    DHCPV4C_SRV_JOURNAL_STATIC_ADD,    /*!< Static binding added. */
+    DHCPV4C_SRV_JOURNAL_STATIC_DEL     /*!< Static binding or lease removed. */
+} dhcpv4c_srv_journal_op_t;
+
+/**
+ * @brief Represents one fixed-size record of the lease journal and of the lease snapshot.
+ *
+ * `expiryTime` is only meaningful while the wall clock is synchronized (`adjtimex()` does not
+ * report `STA_UNSYNC`). A record written with an unsynchronized clock stores 0, and on replay
+ * the remaining time is derived from `leaseTime` instead (see the "Server Lease Journal"
+ * section of the spec).
+ */
+typedef struct {
+    UINT  crc32;                     /*!< CRC-32 of the remaining bytes of the record. */
+    UINT  seqNo;                     /*!< Journal sequence number. */
+    UCHAR op;                        /*!< Operation (see `dhcpv4c_srv_journal_op_t`). */
+    UCHAR mac[DHCPV4C_SRV_MAC_LEN];  /*!< Client hardware address. */
+    UCHAR reserved;                  /*!< Reserved, set to zero. */
+    UINT  ipAddr;                    /*!< Leased IPv4 address. */
+    UINT  leaseTime;                 /*!< Granted lease time (in seconds); 0 for a static binding. */
+    UINT  expiryTime;                /*!< CLOCK_REALTIME seconds at which the lease expires; 0 for a static binding or if the wall clock was not synchronized when the record was written. */
+} dhcpv4c_srv_journal_rec_t;
+
+/**
+ * @brief Represents the header of the lease journal file.
+ *
+ * The header is followed by `dhcpv4c_srv_journal_rec_t` records of `recSize` bytes each. A
+ * journal whose `magic`, `version` or `recSize` does not match is ignored on start and replaced.
+ */
+typedef struct {
+    UINT magic;      /*!< `DHCPV4C_SRV_JOURNAL_MAGIC`. */
+    UINT version;    /*!< `DHCPV4C_SRV_JOURNAL_VERSION`. */
+    UINT recSize;    /*!< `sizeof(dhcpv4c_srv_journal_rec_t)` as seen by the writer. */
+    UINT reserved;   /*!< Reserved, set to zero. */
+} dhcpv4c_srv_journal_hdr_t;
+
+/**
+ * @brief Represents the header of the lease snapshot file.
+ *
+ * The header is followed by `count` `dhcpv4c_srv_journal_rec_t` records of `recSize` bytes
+ * each, one per live lease. A snapshot whose `magic`, `version`, `recSize` or `crc32` does not
+ * match is ignored on start.
+ */
+typedef struct {
+    UINT magic;      /*!< `DHCPV4C_SRV_SNAPSHOT_MAGIC`. */
+    UINT version;    /*!< `DHCPV4C_SRV_JOURNAL_VERSION`. */
+    UINT recSize;    /*!< `sizeof(dhcpv4c_srv_journal_rec_t)` as seen by the writer. */
+    UINT count;      /*!< Number of records that follow. */
+    UINT lastSeqNo;  /*!< Sequence number of the last journal record included in the snapshot. */
+    UINT crc32;      /*!< CRC-32 of all records. */
+} dhcpv4c_srv_snapshot_hdr_t;
+
+DHCPV4C_LAYOUT_CHECK(srv_journal_rec_size, sizeof(dhcpv4c_srv_journal_rec_t) == 28);
+DHCPV4C_LAYOUT_CHECK(srv_journal_hdr_size, sizeof(dhcpv4c_srv_journal_hdr_t) == 16);
+DHCPV4C_LAYOUT_CHECK(srv_snapshot_hdr_size, sizeof(dhcpv4c_srv_snapshot_hdr_t) == 24);
+
+/**
+ * @brief Represents the packet I/O statistics of the DHCPv4 server.
+ */
+typedef struct {
+    ULONG rxPackets;   /*!< Packets received. */
+    ULONG rxBatches;   /*!< Receive system calls that returned at least one packet. */
+    ULONG txPackets;   /*!< Packets sent. */
+    ULONG txBatches;   /*!< Send system calls. */
+    ULONG drops;       /*!< Packets dropped (malformed, or no free buffer). */
+    ULONG acks;        /*!< DHCPACKs sent, i.e., completed DORA or renew exchanges. */
+} dhcpv4c_srv_io_stats_t;
+
+/**
+ * @brief Type of an address range of the DHCPv4 server.
+ */
+typedef enum {
+    DHCPV4C_SRV_RANGE_DYNAMIC,   /*!< Addresses allocated to clients on demand. */
+    DHCPV4C_SRV_RANGE_RESERVED,  /*!< Addresses never handed out (e.g., infrastructure). */
+    DHCPV4C_SRV_RANGE_STATIC     /*!< Addresses handed out only through `dhcpv4c_srv_add_client()` bindings. */
+} dhcpv4c_srv_range_type_t;
+
+/**
+ * @brief Represents the utilisation of one address range.
+ */
+typedef struct {
+    UINT startIp;                    /*!< First address of the range. */
+    UINT endIp;                      /*!< Last address of the range. */
+    dhcpv4c_srv_range_type_t type;   /*!< Range type. */
+    UINT total;                      /*!< Number of addresses in the range. */
+    UINT used;                       /*!< Number of addresses leased or bound. */
+} dhcpv4c_srv_pool_stats_t;
+
+/**
+ * @brief Identifies the implementation that serves the HAL getters.
+ *
+ * Selected from the `UDHCPEnable_v2` configuration parameter.
+ */
+typedef enum {
+    DHCPV4C_BACKEND_OPENSOURCE,   /*!< Open-source DHCPv4 client (`UDHCPEnable_v2` is true). */
+    DHCPV4C_BACKEND_PROPRIETARY   /*!< Vendor DHCPv4 client (`UDHCPEnable_v2` is false). */
+} dhcpv4c_backend_t;
+
+/**
+ * @brief Function table of one backend implementation.
+ *
+ * Each function member has the signature of the public function of the same name without the
+ * `dhcpv4c_` prefix. The `dhcp4c_get_<module>_*` functions of `dhcp4cApi.h` dispatch through the
+ * same members as their `dhcpv4c_get_<module>_*` counterparts.
+ *
+ * The backend sets `size` to `sizeof(dhcpv4c_backend_ops_t)` and `version` to
+ * `DHCPV4C_BACKEND_OPS_VERSION` as it was compiled. Members are only ever appended; the HAL treats
+ * every member that lies beyond `size` as NULL, and a getter whose member is NULL returns
+ * `STATUS_FAILURE`.
+ */
+typedef struct {
+    UINT size;     /*!< `sizeof(dhcpv4c_backend_ops_t)` as seen by the backend. */
+    UINT version;  /*!< `DHCPV4C_BACKEND_OPS_VERSION` as seen by the backend. */
+    INT (*get_ert_lease_time)(UINT *pValue);
+    INT (*get_ert_remain_lease_time)(UINT *pValue);
+    INT (*get_ert_remain_renew_time)(UINT *pValue);
+    INT (*get_ert_remain_rebind_time)(UINT *pValue);
+    INT (*get_ert_config_attempts)(INT *pValue);
+    INT (*get_ert_ifname)(CHAR *pName);
+    INT (*get_ert_fsm_state)(DhcpClientState *pValue);
+    INT (*get_ert_ip_addr)(UINT *pValue);
+    INT (*get_ert_mask)(UINT *pValue);
+    INT (*get_ert_gw)(UINT *pValue);
+    INT (*get_ert_dns_svrs)(dhcpv4c_ip_list_t *pList);
+    INT (*get_ert_dhcp_svr)(UINT *pValue);
+    INT (*get_ecm_lease_time)(UINT *pValue);
+    INT (*get_ecm_remain_lease_time)(UINT *pValue);
+    INT (*get_ecm_remain_renew_time)(UINT *pValue);
+    INT (*get_ecm_remain_rebind_time)(UINT *pValue);
+    INT (*get_ecm_config_attempts)(INT *pValue);
+    INT (*get_ecm_ifname)(CHAR *pName);
+    INT (*get_ecm_fsm_state)(DhcpClientState *pValue);
+    INT (*get_ecm_ip_addr)(UINT *pValue);
+    INT (*get_ecm_mask)(UINT *pValue);
+    INT (*get_ecm_gw)(UINT *pValue);
+    INT (*get_ecm_dns_svrs)(dhcpv4c_ip_list_t *pList);
+    INT (*get_ecm_dhcp_svr)(UINT *pValue);
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+    INT (*get_emta_remain_lease_time)(UINT *pValue);
+    INT (*get_emta_remain_renew_time)(UINT *pValue);
+    INT (*get_emta_remain_rebind_time)(UINT *pValue);
+#endif
+    INT (*get_lease_snapshot)(enum DHCPC_MODULE module, dhcpv4c_lease_snapshot_t *pSnapshot);
+} dhcpv4c_backend_ops_t;
 /** @} */  //END OF GROUP DHCPV4C_HAL_TYPES
 
 /**
@@ -114,6 +612,8 @@ typedef struct {
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ert_lease_time(UINT *pValue);
 
@@ -125,6 +625,10 @@ INT dhcpv4c_get_ert_lease_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_ert_remain_lease_time(UINT *pValue);
 
@@ -136,6 +640,10 @@ INT dhcpv4c_get_ert_remain_lease_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_ert_remain_renew_time(UINT *pValue);
 
@@ -147,6 +655,10 @@ INT dhcpv4c_get_ert_remain_renew_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_ert_remain_rebind_time(UINT *pValue);
 
@@ -158,6 +670,8 @@ INT dhcpv4c_get_ert_remain_rebind_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ert_config_attempts(INT *pValue);
 
@@ -171,6 +685,8 @@ INT dhcpv4c_get_ert_config_attempts(INT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., null pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ert_ifname(CHAR *pName);
 
@@ -179,16 +695,16 @@ INT dhcpv4c_get_ert_ifname(CHAR *pName);
  *
  * This function gets the current state of the DHCP client associated with the E-Router.
  *
- * @param[out] pValue - Pointer to an integer where the DHCP client state will be stored.
- *  @see `_COSA_DML_DHCPC_STATUS` for possible values.
+ * @param[out] pValue - Pointer to a `DhcpClientState` where the DHCP client state will be stored.
+ *  @see `DhcpClientState` for possible values.
  *
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
- * 
- * TODO: Update `pValue` type to `_COSA_DML_DHCPC_STATUS` for type safety and clarity.
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
-INT dhcpv4c_get_ert_fsm_state(INT *pValue);
+INT dhcpv4c_get_ert_fsm_state(DhcpClientState *pValue);
 
 /**
  * @brief Retrieves the IP address of the E-Router interface.
@@ -200,6 +716,8 @@ INT dhcpv4c_get_ert_fsm_state(INT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented.
  * TODO: Consider using a more appropriate data type for `pValue` to store the IPv4 address.
@@ -214,6 +732,8 @@ INT dhcpv4c_get_ert_ip_addr(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * TODO: Consider using a more appropriate data type for `pValue` to store the subnet mask.
  */
@@ -227,6 +747,8 @@ INT dhcpv4c_get_ert_mask(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented. 
  *
@@ -242,6 +764,8 @@ INT dhcpv4c_get_ert_gw(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ert_dns_svrs(dhcpv4c_ip_list_t *pList);
 
@@ -253,6 +777,8 @@ INT dhcpv4c_get_ert_dns_svrs(dhcpv4c_ip_list_t *pList);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented. 
  *
@@ -268,6 +794,8 @@ INT dhcpv4c_get_ert_dhcp_svr(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ecm_lease_time(UINT *pValue);
 
@@ -279,6 +807,10 @@ INT dhcpv4c_get_ecm_lease_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_ecm_remain_lease_time(UINT *pValue);
 
@@ -290,6 +822,10 @@ INT dhcpv4c_get_ecm_remain_lease_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_ecm_remain_renew_time(UINT *pValue);
 
@@ -301,6 +837,10 @@ INT dhcpv4c_get_ecm_remain_renew_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_ecm_remain_rebind_time(UINT *pValue);
 
@@ -312,6 +852,8 @@ INT dhcpv4c_get_ecm_remain_rebind_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ecm_config_attempts(INT *pValue);
 
@@ -325,6 +867,8 @@ INT dhcpv4c_get_ecm_config_attempts(INT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., null pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
 INT dhcpv4c_get_ecm_ifname(CHAR *pName);
 
@@ -333,16 +877,16 @@ INT dhcpv4c_get_ecm_ifname(CHAR *pName);
  *
  * This function gets the current state of the DHCP client associated with the Embedded Cable Modem (ECM).
  *
- * @param[out] pValue - Pointer to an integer where the DHCP client state will be stored.
- *  See `_COSA_DML_DHCPC_STATUS` for possible values.
+ * @param[out] pValue - Pointer to a `DhcpClientState` where the DHCP client state will be stored.
+ *  See `DhcpClientState` for possible values.
  *
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
- * 
- * TODO: Update `pValue` type to `_COSA_DML_DHCPC_STATUS` for type safety and clarity.
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  */
-INT dhcpv4c_get_ecm_fsm_state(INT *pValue);
+INT dhcpv4c_get_ecm_fsm_state(DhcpClientState *pValue);
 
 /**
  * @brief Retrieves the ECM's (Embedded Cable Modem) IP address.
@@ -352,6 +896,8 @@ INT dhcpv4c_get_ecm_fsm_state(INT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented. 
  *
@@ -367,6 +913,8 @@ INT dhcpv4c_get_ecm_ip_addr(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  * 
  * TODO: Consider using a more appropriate data type for `pValue` to store the subnet mask.
  */
@@ -380,6 +928,8 @@ INT dhcpv4c_get_ecm_mask(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  * 
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented. 
  * 
@@ -395,6 +945,8 @@ INT dhcpv4c_get_ecm_gw(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  * 
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented.
  */
@@ -408,6 +960,8 @@ INT dhcpv4c_get_ecm_dns_svrs(dhcpv4c_ip_list_t *pList);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
  *
  * @see ipv4AddrList_t  For a description of how IPv4 addresses are represented. 
  *
@@ -424,6 +978,10 @@ INT dhcpv4c_get_ecm_dhcp_svr(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_emta_remain_lease_time(UINT *pValue);
 
@@ -435,6 +993,10 @@ INT dhcpv4c_get_emta_remain_lease_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_emta_remain_renew_time(UINT *pValue);
 
@@ -446,8 +1008,695 @@ INT dhcpv4c_get_emta_remain_renew_time(UINT *pValue);
  * @returns Status of the operation:
  * @retval STATUS_SUCCESS - On success.
  * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ *
+ * @see dhcpv4c_get_lease_deadlines() - The remaining time is computed from the lease deadline.
  */
 INT dhcpv4c_get_emta_remain_rebind_time(UINT *pValue);
 #endif
+
+/**
+ * @brief Retrieves all lease parameters of a module in a single call.
+ *
+ * This function fills `pSnapshot` with the values otherwise returned by the individual
+ * `dhcpv4c_get_<module>_*` getters. The values are taken from one copy of the module's shared
+ * lease record, so the caller never sees fields from two different leases.
+ *
+ * @param[in]  module    - Module to query: `DHCPC_EROUTER`, `DHCPC_ECM` or `DHCPC_EMTA`.
+ * @param[out] pSnapshot - Pointer to a `dhcpv4c_lease_snapshot_t` structure to store the lease parameters.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module, retrieval error).
+ * @retval STATUS_STALE - Non-blocking call mode only: the last known value was returned (see `dhcpv4c_set_call_mode()`).
+ * @retval STATUS_NOT_READY - Non-blocking call mode only: no value is known yet; the output is not written.
+ */
+INT dhcpv4c_get_lease_snapshot(enum DHCPC_MODULE module, dhcpv4c_lease_snapshot_t *pSnapshot);
+
+/**
+ * @brief Retrieves the lease generation number of a module.
+ *
+ * The generation is 0 until the module's lease is first published. It then increases by at least
+ * one on every DHCPACK, DHCPNAK, release or other change of a lease parameter, and never
+ * decreases while the system is up, including across restarts of the process that owns the
+ * clients. A caller that remembers the last generation it read needs to re-read the lease only
+ * if the value moved. This function performs a single atomic 64-bit load from shared memory and
+ * makes no system call.
+ *
+ * @param[in]  module      - Module to query.
+ * @param[out] pGeneration - Pointer to a `uint64_t` to store the generation number.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module).
+ */
+INT dhcpv4c_get_lease_generation(enum DHCPC_MODULE module, uint64_t *pGeneration);
+
+/**
+ * @brief Retrieves a zero-copy view of an IPv4 address-list option of a module's current lease.
+ *
+ * Any option whose payload is a list of IPv4 addresses can be requested, e.g.,
+ * `DHCPV4C_OPTION_ROUTERS` (3), `DHCPV4C_OPTION_DNS_SVRS` (6) or `DHCPV4C_OPTION_NTP_SVRS` (42).
+ * No addresses are copied and the list is not truncated. To check that the values read
+ * through the view are consistent, the caller compares `pView->generation` with
+ * `dhcpv4c_get_lease_generation()` after using them. If the two differ, the caller takes a new view.
+ *
+ * @param[in]  module - Module to query.
+ * @param[in]  option - DHCP option code.
+ * @param[out] pView  - Pointer to a `dhcpv4c_addr_list_view_t` structure to store the view.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, option not present in the lease,
+ *                          option payload is not a list of IPv4 addresses).
+ */
+INT dhcpv4c_get_addr_list_view(enum DHCPC_MODULE module, UCHAR option, dhcpv4c_addr_list_view_t *pView);
+
+/**
+ * @brief Retrieves a zero-copy, indexed view of all DHCP options of a module's current lease.
+ *
+ * This gives access to options that have no dedicated getter, e.g., 43, 121, 249, 125 or 42.
+ * Individual options are looked up with `dhcpv4c_find_option()` and enumerated with
+ * `dhcpv4c_next_option()`. Neither call parses or copies the options.
+ *
+ * @param[in]  module - Module to query.
+ * @param[out] pView  - Pointer to a `dhcpv4c_options_view_t` structure to store the view.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, no lease bound).
+ */
+INT dhcpv4c_get_options_view(enum DHCPC_MODULE module, dhcpv4c_options_view_t *pView);
+
+/**
+ * @brief Looks up one option in an options view.
+ *
+ * The lookup is a single index access (O(1)).
+ *
+ * @param[in]  pView  - View returned by `dhcpv4c_get_options_view()`.
+ * @param[in]  code   - DHCP option code.
+ * @param[out] ppData - Pointer to store the address of the option payload.
+ * @param[out] pLen   - Pointer to store the payload length in bytes.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, option not present).
+ */
+INT dhcpv4c_find_option(const dhcpv4c_options_view_t *pView, UCHAR code, const UCHAR **ppData, UINT *pLen);
+
+/**
+ * @brief Iterates over the options present in an options view, in ascending option-code order.
+ *
+ * Set `*pCursor` to 0 before the first call. Each call returns the next present option and
+ * advances the cursor.
+ *
+ * @param[in]     pView   - View returned by `dhcpv4c_get_options_view()`.
+ * @param[in,out] pCursor - Iteration cursor.
+ * @param[out]    pCode   - Pointer to store the option code.
+ * @param[out]    ppData  - Pointer to store the address of the option payload.
+ * @param[out]    pLen    - Pointer to store the payload length in bytes.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - An option was returned.
+ * @retval STATUS_FAILURE - No more options, or invalid pointer.
+ */
+INT dhcpv4c_next_option(const dhcpv4c_options_view_t *pView, UINT *pCursor, UCHAR *pCode, const UCHAR **ppData, UINT *pLen);
+
+/**
+ * @brief Retrieves the absolute CLOCK_MONOTONIC deadlines of a module's current lease.
+ *
+ * The deadlines do not change until the lease is renewed, rebound or released, so callers can
+ * cache them and compute remaining times locally. The `*_remain_*_time` getters are derived
+ * from these deadlines.
+ *
+ * @param[in]  module     - Module to query.
+ * @param[out] pDeadlines - Pointer to a `dhcpv4c_lease_deadlines_t` structure to store the deadlines.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module, retrieval error).
+ */
+INT dhcpv4c_get_lease_deadlines(enum DHCPC_MODULE module, dhcpv4c_lease_deadlines_t *pDeadlines);
+
+/**
+ * @brief Retrieves the most recent FSM transitions of a module.
+ *
+ * Entries are returned oldest first. At most `DHCPV4C_FSM_HISTORY_DEPTH` transitions are kept.
+ *
+ * @param[in]  module     - Module to query.
+ * @param[out] pEntries   - Array of `maxEntries` `dhcpv4c_fsm_transition_t` structures to fill.
+ * @param[in]  maxEntries - Number of entries in `pEntries`; the newest transitions are returned if it is too small.
+ * @param[out] pCount     - Pointer to store the number of entries filled.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module).
+ */
+INT dhcpv4c_get_fsm_history(enum DHCPC_MODULE module, dhcpv4c_fsm_transition_t *pEntries, UINT maxEntries, UINT *pCount);
+
+/**
+ * @brief Retrieves the aggregated FSM metrics of a module.
+ *
+ * @param[in]  module   - Module to query.
+ * @param[out] pMetrics - Pointer to a `dhcpv4c_fsm_metrics_t` structure to store the metrics.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, unsupported module).
+ */
+INT dhcpv4c_get_fsm_metrics(enum DHCPC_MODULE module, dhcpv4c_fsm_metrics_t *pMetrics);
+
+/**
+ * @brief Publishes a module's current lease to the shared-memory segment.
+ *
+ * Called by the backend whenever a lease is acquired, renewed, rebound or released.
+ * The record is updated under its sequence counter so that concurrent readers in other
+ * processes never observe a partially written lease.
+ *
+ * @param[in] module    - Module the lease belongs to.
+ * @param[in] pSnapshot - Pointer to the lease parameters to publish.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, segment not writable by the caller).
+ */
+INT dhcpv4c_publish_lease(enum DHCPC_MODULE module, const dhcpv4c_lease_snapshot_t *pSnapshot);
+
+/**
+ * @brief Subscribes to lease events of a module through a pollable file descriptor.
+ *
+ * The returned descriptor becomes readable when at least one event is queued; read the events
+ * with `dhcpv4c_read_lease_event()`. If the caller falls behind, older events are dropped and the
+ * next event carries `DHCPV4C_EVENT_OVERFLOW`.
+ *
+ * @param[in]  module    - Module to watch.
+ * @param[in]  eventMask - Bitmask of `DHCPV4C_EVENT_*` values to deliver.
+ * @param[out] pFd       - Pointer to an integer to store the non-blocking file descriptor.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, invalid mask, out of descriptors).
+ */
+INT dhcpv4c_subscribe_lease_events(enum DHCPC_MODULE module, UINT eventMask, INT *pFd);
+
+/**
+ * @brief Reads the next queued lease event from a subscription descriptor.
+ *
+ * This function never blocks.
+ *
+ * @param[in]  fd     - Descriptor returned by `dhcpv4c_subscribe_lease_events()`.
+ * @param[out] pEvent - Pointer to a `dhcpv4c_lease_event_t` structure to store the event.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., no event pending, invalid descriptor, invalid pointer).
+ */
+INT dhcpv4c_read_lease_event(INT fd, dhcpv4c_lease_event_t *pEvent);
+
+/**
+ * @brief Cancels a subscription and closes its descriptor.
+ *
+ * @param[in] fd - Descriptor returned by `dhcpv4c_subscribe_lease_events()`.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid descriptor).
+ */
+INT dhcpv4c_unsubscribe_lease_events(INT fd);
+
+/**
+ * @brief Registers a callback for lease events of a module.
+ *
+ * The callback runs on a HAL-internal thread. It must return quickly and must not call
+ * `dhcpv4c_unregister_lease_event_cb()`.
+ *
+ * @param[in] module    - Module to watch.
+ * @param[in] eventMask - Bitmask of `DHCPV4C_EVENT_*` values to deliver.
+ * @param[in] cb        - Callback to invoke.
+ * @param[in] pUserData - User data passed unchanged to the callback.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., null callback, invalid mask).
+ */
+INT dhcpv4c_register_lease_event_cb(enum DHCPC_MODULE module, UINT eventMask, dhcpv4c_lease_event_cb_t cb, void *pUserData);
+
+/**
+ * @brief Unregisters a callback registered with `dhcpv4c_register_lease_event_cb()`.
+ *
+ * When this function returns, the callback is no longer running and will not be invoked again.
+ *
+ * @param[in] module - Module the callback was registered for.
+ * @param[in] cb     - Callback to remove.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., callback not registered).
+ */
+INT dhcpv4c_unregister_lease_event_cb(enum DHCPC_MODULE module, dhcpv4c_lease_event_cb_t cb);
+
+/**
+ * @brief Retrieves the lease generation number of a client instance.
+ *
+ * Same as `dhcpv4c_get_lease_generation()`, for an instance handle.
+ *
+ * @param[in]  ctx         - Instance handle.
+ * @param[out] pGeneration - Pointer to a `uint64_t` to store the generation number.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer).
+ */
+INT dhcpv4c_ctx_get_lease_generation(dhcp4c_ctx_t ctx, uint64_t *pGeneration);
+
+/**
+ * @brief Retrieves the absolute CLOCK_MONOTONIC deadlines of a client instance's current lease.
+ *
+ * Same as `dhcpv4c_get_lease_deadlines()`, for an instance handle.
+ *
+ * @param[in]  ctx        - Instance handle.
+ * @param[out] pDeadlines - Pointer to a `dhcpv4c_lease_deadlines_t` structure to store the deadlines.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer).
+ */
+INT dhcpv4c_ctx_get_lease_deadlines(dhcp4c_ctx_t ctx, dhcpv4c_lease_deadlines_t *pDeadlines);
+
+/**
+ * @brief Retrieves a zero-copy view of an IPv4 address-list option of a client instance's current lease.
+ *
+ * Same as `dhcpv4c_get_addr_list_view()`, for an instance handle.
+ *
+ * @param[in]  ctx    - Instance handle.
+ * @param[in]  option - DHCP option code.
+ * @param[out] pView  - Pointer to a `dhcpv4c_addr_list_view_t` structure to store the view.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer, option not present
+ *                          in the lease, option payload is not a list of IPv4 addresses).
+ */
+INT dhcpv4c_ctx_get_addr_list_view(dhcp4c_ctx_t ctx, UCHAR option, dhcpv4c_addr_list_view_t *pView);
+
+/**
+ * @brief Retrieves a zero-copy, indexed view of all DHCP options of a client instance's current lease.
+ *
+ * Same as `dhcpv4c_get_options_view()`, for an instance handle.
+ *
+ * @param[in]  ctx   - Instance handle.
+ * @param[out] pView - Pointer to a `dhcpv4c_options_view_t` structure to store the view.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer, no lease bound).
+ */
+INT dhcpv4c_ctx_get_options_view(dhcp4c_ctx_t ctx, dhcpv4c_options_view_t *pView);
+
+/**
+ * @brief Retrieves the most recent FSM transitions of a client instance.
+ *
+ * Same as `dhcpv4c_get_fsm_history()`, for an instance handle.
+ *
+ * @param[in]  ctx        - Instance handle.
+ * @param[out] pEntries   - Array of `maxEntries` `dhcpv4c_fsm_transition_t` structures to fill.
+ * @param[in]  maxEntries - Number of entries in `pEntries`.
+ * @param[out] pCount     - Pointer to store the number of entries filled.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer).
+ */
+INT dhcpv4c_ctx_get_fsm_history(dhcp4c_ctx_t ctx, dhcpv4c_fsm_transition_t *pEntries, UINT maxEntries, UINT *pCount);
+
+/**
+ * @brief Retrieves the aggregated FSM metrics of a client instance.
+ *
+ * Same as `dhcpv4c_get_fsm_metrics()`, for an instance handle.
+ *
+ * @param[in]  ctx      - Instance handle.
+ * @param[out] pMetrics - Pointer to a `dhcpv4c_fsm_metrics_t` structure to store the metrics.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer).
+ */
+INT dhcpv4c_ctx_get_fsm_metrics(dhcp4c_ctx_t ctx, dhcpv4c_fsm_metrics_t *pMetrics);
+
+/**
+ * @brief Subscribes to lease events of a client instance through a pollable file descriptor.
+ *
+ * Same as `dhcpv4c_subscribe_lease_events()`, for an instance handle.
+ *
+ * @param[in]  ctx       - Instance handle.
+ * @param[in]  eventMask - Bitmask of `DHCPV4C_EVENT_*` values to deliver.
+ * @param[out] pFd       - Pointer to an integer to store the non-blocking file descriptor.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, invalid pointer, invalid mask, out of descriptors).
+ */
+INT dhcpv4c_ctx_subscribe_lease_events(dhcp4c_ctx_t ctx, UINT eventMask, INT *pFd);
+
+/**
+ * @brief Registers a callback for lease events of a client instance.
+ *
+ * Same as `dhcpv4c_register_lease_event_cb()`, for an instance handle.
+ *
+ * @param[in] ctx       - Instance handle.
+ * @param[in] eventMask - Bitmask of `DHCPV4C_EVENT_*` values to deliver.
+ * @param[in] cb        - Callback to invoke.
+ * @param[in] pUserData - User data passed unchanged to the callback.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, null callback, invalid mask).
+ */
+INT dhcpv4c_ctx_register_lease_event_cb(dhcp4c_ctx_t ctx, UINT eventMask, dhcpv4c_lease_event_cb_t cb, void *pUserData);
+
+/**
+ * @brief Unregisters a callback registered with `dhcpv4c_ctx_register_lease_event_cb()`.
+ *
+ * Same as `dhcpv4c_unregister_lease_event_cb()`, for an instance handle.
+ *
+ * @param[in] ctx - Instance handle the callback was registered for.
+ * @param[in] cb  - Callback to remove.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid or stale handle, callback not registered).
+ */
+INT dhcpv4c_ctx_unregister_lease_event_cb(dhcp4c_ctx_t ctx, dhcpv4c_lease_event_cb_t cb);
+
+/**
+ * @brief Retrieves the per-API call statistics of the calling process.
+ *
+ * Counters are kept per thread and summed by this function, so recording them adds no shared
+ * cache-line writes to the getters. Only APIs that have been called at least once are returned.
+ *
+ * @param[out] pStats     - Array of `maxEntries` `dhcpv4c_api_stats_t` structures to fill.
+ * @param[in]  maxEntries - Number of entries in `pStats`.
+ * @param[out] pCount     - Pointer to store the number of entries filled.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer), or if `maxEntries` is too small;
+ *                          `*pCount` is then set to the number of entries required.
+ */
+INT dhcpv4c_get_stats(dhcpv4c_api_stats_t *pStats, UINT maxEntries, UINT *pCount);
+
+/**
+ * @brief Resets the per-API call statistics of the calling process.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure.
+ */
+INT dhcpv4c_reset_stats(void);
+
+/**
+ * @brief Appends the per-API call statistics of the calling process to a text file.
+ *
+ * Each line holds a timestamp, the process ID, the API name, the call and error counts,
+ * and both latency histograms.
+ *
+ * @param[in] pPath - File to append to, or NULL for `DHCPV4C_STATS_LOG_FILE`.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., file not writable).
+ */
+INT dhcpv4c_dump_stats(const CHAR *pPath);
+
+/**
+ * @brief Sets the call mode of the calling thread.
+ *
+ * The call mode applies to the lease getters that can reach the backend: the per-module
+ * `dhcpv4c_get_<module>_*` and `dhcp4c_get_<module>_*` getters, `dhcpv4c_get_lease_snapshot()`,
+ * `dhcp4c_get_lease_snapshot()`, `dhcp4c_get()`, `dhcp4c_ctx_get()` and
+ * `dhcp4c_ctx_get_lease_snapshot()`. Answers from the shared lease record are always immediate.
+ * In `DHCPV4C_CALL_MODE_NONBLOCKING` mode, a getter that must call the backend returns within
+ * `deadlineMs`. If the backend cannot answer in time, the getter returns the last known value
+ * with `STATUS_STALE`, or `STATUS_NOT_READY` without writing its output if no value has been known
+ * yet, and the HAL refreshes the data in the background. Callers then see the fresh value on a later call or
+ * through a `DHCPV4C_EVENT_PARAM_CHANGE` event. The default mode is `DHCPV4C_CALL_MODE_BLOCKING`,
+ * in which these status codes are never returned.
+ *
+ * @param[in] mode       - Call mode to use.
+ * @param[in] deadlineMs - Maximum time a getter may take in non-blocking mode, in milliseconds; 0 means
+ *                         answer only from data already published. Ignored in blocking mode.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid mode).
+ */
+INT dhcpv4c_set_call_mode(dhcpv4c_call_mode_t mode, UINT deadlineMs);
+
+/**
+ * @brief Registers the function table of a backend.
+ *
+ * Called by the open-source and proprietary implementations when the library is loaded.
+ * The table must stay valid until the library is unloaded.
+ *
+ * @param[in] backend - Backend the table belongs to.
+ * @param[in] pOps    - Pointer to the backend's `dhcpv4c_backend_ops_t` function table.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, invalid backend, `size` smaller
+ *                          than the table of version 1, or `version` newer than the HAL).
+ */
+INT dhcpv4c_register_backend(dhcpv4c_backend_t backend, const dhcpv4c_backend_ops_t *pOps);
+
+/**
+ * @brief Re-reads `UDHCPEnable_v2` and selects the matching backend.
+ *
+ * The backend is selected once when the library is loaded. Call this function after
+ * `UDHCPEnable_v2` changes; the active function table is replaced atomically, so concurrent
+ * getters complete on either the old or the new backend.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., parameter not readable, backend not registered).
+ */
+INT dhcpv4c_select_backend(void);
+
+/**
+ * @brief Retrieves the currently selected backend.
+ *
+ * @param[out] pBackend - Pointer to a `dhcpv4c_backend_t` to store the active backend.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, no backend selected).
+ */
+INT dhcpv4c_get_backend(dhcpv4c_backend_t *pBackend);
+/**********************************************************************************
+ *
+ *  DHCPV4-Server Subsystem level function prototypes
+ *
+**********************************************************************************/
+
+/**
+ * @brief Starts the DHCPv4 server.
+ *
+ * The lease table is sized from `maxLeases`, so lookups stay O(1) up to that many clients.
+ *
+ * @param[in] pConfig - Pointer to the server configuration.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, already running, interface not found,
+ *                          out of memory).
+ */
+INT dhcpv4c_srv_start(const dhcpv4c_srv_config_t *pConfig);
+
+/**
+ * @brief Stops the DHCPv4 server and releases its resources.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., server not running).
+ */
+INT dhcpv4c_srv_stop(void);
+
+/**
+ * @brief Adds a static binding of a client MAC address to an IPv4 address.
+ *
+ * @param[in] pMac   - Client hardware address (`DHCPV4C_SRV_MAC_LEN` bytes).
+ * @param[in] ipAddr - Address to hand to the client.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running, address in use
+ *                          by another client, table full).
+ */
+INT dhcpv4c_srv_add_client(const UCHAR *pMac, UINT ipAddr);
+
+/**
+ * @brief Removes the binding and any active lease of a client.
+ *
+ * @param[in] pMac - Client hardware address (`DHCPV4C_SRV_MAC_LEN` bytes).
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running, client not found).
+ */
+INT dhcpv4c_srv_del_client(const UCHAR *pMac);
+
+/**
+ * @brief Looks up the lease of a client by MAC address.
+ *
+ * @param[in]  pMac   - Client hardware address (`DHCPV4C_SRV_MAC_LEN` bytes).
+ * @param[out] pLease - Pointer to a `dhcpv4c_srv_lease_t` structure to store the lease.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running, client not found).
+ */
+INT dhcpv4c_srv_get_lease_by_mac(const UCHAR *pMac, dhcpv4c_srv_lease_t *pLease);
+
+/**
+ * @brief Looks up a lease by IPv4 address.
+ *
+ * @param[in]  ipAddr - Leased address.
+ * @param[out] pLease - Pointer to a `dhcpv4c_srv_lease_t` structure to store the lease.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running, address not leased).
+ */
+INT dhcpv4c_srv_get_lease_by_ip(UINT ipAddr, dhcpv4c_srv_lease_t *pLease);
+
+/**
+ * @brief Retrieves the number of leases and static bindings in the lease table.
+ *
+ * @param[out] pCount - Pointer to store the number of entries.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running).
+ */
+INT dhcpv4c_srv_get_lease_count(UINT *pCount);
+
+/**
+ * @brief Enumerates the lease table in batches.
+ *
+ * Set `*pCursor` to 0 before the first call and call again until `*pCount` is 0. Leases
+ * added or removed during the enumeration may or may not be returned.
+ *
+ * @param[in,out] pCursor    - Enumeration cursor.
+ * @param[out]    pLeases    - Array of `maxEntries` `dhcpv4c_srv_lease_t` structures to fill.
+ * @param[in]     maxEntries - Number of entries in `pLeases`.
+ * @param[out]    pCount     - Pointer to store the number of entries filled.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running).
+ */
+INT dhcpv4c_srv_enum_leases(UINT *pCursor, dhcpv4c_srv_lease_t *pLeases, UINT maxEntries, UINT *pCount);
+
+/**
+ * @brief Adds an address range to the DHCPv4 server.
+ *
+ * Ranges must not overlap. A reserved or static range may lie inside a dynamic range, in which
+ * case its addresses are removed from the dynamic range.
+ *
+ * @param[in] startIp - First address of the range.
+ * @param[in] endIp   - Last address of the range.
+ * @param[in] type    - Range type.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., server not running, `startIp` > `endIp`, range outside
+ *                          the server subnet, overlapping dynamic ranges).
+ */
+INT dhcpv4c_srv_add_range(UINT startIp, UINT endIp, dhcpv4c_srv_range_type_t type);
+
+/**
+ * @brief Retrieves the utilisation of every address range.
+ *
+ * @param[out] pStats     - Array of `maxEntries` `dhcpv4c_srv_pool_stats_t` structures to fill.
+ * @param[in]  maxEntries - Number of entries in `pStats`.
+ * @param[out] pCount     - Pointer to store the number of entries filled.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running), or if `maxEntries`
+ *                          is too small; `*pCount` is then set to the number of ranges.
+ */
+INT dhcpv4c_srv_get_pool_stats(dhcpv4c_srv_pool_stats_t *pStats, UINT maxEntries, UINT *pCount);
+
+/**
+ * @brief Retrieves a pollable descriptor that becomes readable when leases have expired.
+ *
+ * Expired leases are read with `dhcpv4c_srv_read_expired()`. The descriptor stays valid until
+ * `dhcpv4c_srv_stop()`.
+ *
+ * @param[out] pFd - Pointer to an integer to store the non-blocking descriptor.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running).
+ */
+INT dhcpv4c_srv_get_expiry_fd(INT *pFd);
+
+/**
+ * @brief Reads leases that have expired and been reclaimed since the last call.
+ *
+ * Each returned lease has already been removed from the lease table and its address returned
+ * to the pool. This function never blocks.
+ *
+ * Reclaimed leases wait in a queue of `expiryQueueLen` entries. Reclamation never waits for the
+ * caller: if the queue is full, the oldest entry is dropped and counted. The count is reported
+ * and reset by the next call. A caller that sees a non-zero `*pDropped` has missed expirations
+ * and re-synchronizes with `dhcpv4c_srv_enum_leases()`.
+ *
+ * @param[out] pLeases    - Array of `maxEntries` `dhcpv4c_srv_lease_t` structures to fill.
+ * @param[in]  maxEntries - Number of entries in `pLeases`.
+ * @param[out] pCount     - Pointer to store the number of entries filled; 0 if none are pending.
+ * @param[out] pDropped   - Pointer to store the number of reclaimed leases dropped from the full
+ *                          queue since the previous call; may be NULL.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running).
+ */
+INT dhcpv4c_srv_read_expired(dhcpv4c_srv_lease_t *pLeases, UINT maxEntries, UINT *pCount, UINT *pDropped);
+
+/**
+ * @brief Writes all unsynced lease journal records to stable storage.
+ *
+ * Normally the server syncs the journal on its own within `fsyncIntervalMs`. Call this
+ * function before a planned shutdown or upgrade.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., server not running, persistence disabled, I/O error).
+ */
+INT dhcpv4c_srv_sync(void);
+
+/**
+ * @brief Compacts the lease journal into a new snapshot.
+ *
+ * Compaction also runs automatically when the journal grows larger than the snapshot.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., server not running, persistence disabled, I/O error).
+ */
+INT dhcpv4c_srv_compact(void);
+
+/**
+ * @brief Retrieves the packet I/O statistics of the DHCPv4 server.
+ *
+ * @param[out] pStats - Pointer to a `dhcpv4c_srv_io_stats_t` structure to store the statistics.
+ *
+ * @returns Status of the operation:
+ * @retval STATUS_SUCCESS - On success.
+ * @retval STATUS_FAILURE - On failure (e.g., invalid pointer, server not running).
+ */
+INT dhcpv4c_srv_get_io_stats(dhcpv4c_srv_io_stats_t *pStats);
 /** @} */  //END OF GROUP DHCPV4C_HAL_APIS
 #endif
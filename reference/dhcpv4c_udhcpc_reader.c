@@ -0,0 +1,373 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2023 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**
+ * @file dhcpv4c_udhcpc_reader.c
+ * @brief Reference lease-state reader of the open-source backend.
+ *
+ * Implements the udhcpc contract of the spec's "Open-Source Backend" section. The reader
+ * watches `DHCPV4C_UDHCPC_STATE_DIR` with inotify, parses a `<ifname>.lease` file only when it
+ * is replaced, and publishes the parsed lease with `dhcpv4c_publish_lease()`. Getters are then
+ * answered from the published record; nothing on the getter path forks, runs a shell or reads
+ * the lease files.
+ *
+ * Each `module=ifname` argument maps an interface to a client module, e.g. `ert=erouter0`.
+ * With `-1` the reader parses the current files once, prints the published snapshot of each
+ * module as one JSON object per line and exits.
+ *
+ * Usage: dhcpv4c_udhcpc_reader [-d dir] [-1] module=ifname...
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+
+#include "dhcpv4c_api.h"
+
+#define READER_LEASE_SUFFIX  ".lease"
+
+typedef struct {
+    const char *pName;
+    enum DHCPC_MODULE module;
+} reader_module_name_t;
+
+static const reader_module_name_t g_moduleNames[] = {
+    { "ert", DHCPC_EROUTER },
+    { "ecm", DHCPC_ECM },
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+    { "emta", DHCPC_EMTA },
+#endif
+};
+
+/* Interface watched for each module, empty if the module is not watched. */
+static CHAR g_ifNames[DHCPC_MODULE_MAX][DHCPV4_MAX_IFNAME_LEN];
+
+static uint64_t reader_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Parses a dotted-quad address into host byte order; returns 0 on success. */
+static int reader_parse_addr(const char *pStr, UINT *pAddr)
+{
+    struct in_addr a;
+
+    if (inet_pton(AF_INET, pStr, &a) != 1)
+        return -1;
+    *pAddr = ntohl(a.s_addr);
+    return 0;
+}
+
+/* Parses a space-separated address list, keeping at most `max` entries. */
+static INT reader_parse_addr_list(char *pStr, UINT *pAddrs, INT max)
+{
+    char *pSave = NULL;
+    char *pTok;
+    INT n = 0;
+
+    for (pTok = strtok_r(pStr, " ", &pSave); pTok != NULL && n < max; pTok = strtok_r(NULL, " ", &pSave)) {
+        if (reader_parse_addr(pTok, &pAddrs[n]) == 0)
+            n++;
+    }
+    return n;
+}
+
+/* Parses a 4-byte option exported by udhcpc as 8 hex digits (e.g. `opt58`). */
+static int reader_parse_opt_u32(const char *pHex, UINT *pValue)
+{
+    char *pEnd;
+    unsigned long v;
+
+    if (strlen(pHex) != 8)
+        return -1;
+    errno = 0;
+    v = strtoul(pHex, &pEnd, 16);
+    if (errno != 0 || *pEnd != '\0')
+        return -1;
+    *pValue = (UINT)v;
+    return 0;
+}
+
+/*
+ * Parses one `<ifname>.lease` file into `pLease`. Deadlines are taken relative to `nowNs`, the
+ * CLOCK_MONOTONIC time at which the new file was seen. Returns 0 on success.
+ */
+static int reader_parse_file(const char *pPath, const char *pIfName, uint64_t nowNs,
+                             dhcpv4c_lease_snapshot_t *pLease)
+{
+    char *pLine = NULL;
+    size_t cap = 0;
+    ssize_t len;
+    UINT t1 = 0, t2 = 0;
+    UINT router[1];
+    BOOL bound = FALSE;
+    FILE *fp;
+
+    fp = fopen(pPath, "r");
+    if (fp == NULL)
+        return -1;
+
+    memset(pLease, 0, sizeof(*pLease));
+    strncpy(pLease->ifName, pIfName, sizeof(pLease->ifName) - 1);
+    pLease->fsmState = DHCPC_STATE_INIT_SELECTING;
+
+    while ((len = getline(&pLine, &cap, fp)) >= 0) {
+        char *pValue;
+
+        if (len > 0 && pLine[len - 1] == '\n')
+            pLine[len - 1] = '\0';
+        pValue = strchr(pLine, '=');
+        if (pValue == NULL)
+            continue;
+        *pValue++ = '\0';
+
+        if (strcmp(pLine, "event") == 0) {
+            if (strcmp(pValue, "bound") == 0 || strcmp(pValue, "renew") == 0)
+                bound = TRUE;
+            else if (strcmp(pValue, "deconfig") == 0)
+                pLease->fsmState = DHCPC_STATE_RELEASED;
+        } else if (strcmp(pLine, "attempts") == 0) {
+            pLease->configAttempts = atoi(pValue);
+        } else if (strcmp(pLine, "ip") == 0) {
+            reader_parse_addr(pValue, &pLease->ipAddr);
+        } else if (strcmp(pLine, "subnet") == 0) {
+            reader_parse_addr(pValue, &pLease->mask);
+        } else if (strcmp(pLine, "router") == 0) {
+            if (reader_parse_addr_list(pValue, router, 1) == 1)
+                pLease->gw = router[0];
+        } else if (strcmp(pLine, "dns") == 0) {
+            pLease->dnsSvrs.number = reader_parse_addr_list(pValue, pLease->dnsSvrs.addrs, DHCPV4_MAX_IPV4_ADDRS);
+        } else if (strcmp(pLine, "serverid") == 0) {
+            reader_parse_addr(pValue, &pLease->dhcpSvr);
+        } else if (strcmp(pLine, "lease") == 0) {
+            pLease->leaseTime = (UINT)strtoul(pValue, NULL, 10);
+        } else if (strcmp(pLine, "opt58") == 0) {
+            reader_parse_opt_u32(pValue, &t1);
+        } else if (strcmp(pLine, "opt59") == 0) {
+            reader_parse_opt_u32(pValue, &t2);
+        }
+    }
+    free(pLine);
+    fclose(fp);
+
+    if (!bound || pLease->leaseTime == 0) {
+        /* leasefail or deconfig: no lease is held, only the state and attempts are kept. */
+        INT attempts = pLease->configAttempts;
+        INT state = bound ? DHCPC_STATE_INIT_SELECTING : pLease->fsmState;
+
+        memset(pLease, 0, sizeof(*pLease));
+        strncpy(pLease->ifName, pIfName, sizeof(pLease->ifName) - 1);
+        pLease->configAttempts = attempts;
+        pLease->fsmState = state;
+        return 0;
+    }
+
+    /* RFC 2131, section 4.4.5: T1 = 0.5 and T2 = 0.875 times the lease unless the server sent them. */
+    if (t2 == 0 || t2 > pLease->leaseTime)
+        t2 = (UINT)((uint64_t)pLease->leaseTime * 7 / 8);
+    if (t1 == 0 || t1 > t2)
+        t1 = pLease->leaseTime / 2;
+
+    pLease->fsmState = DHCPC_STATE_BOUND;
+    pLease->remainLeaseTime = pLease->leaseTime;
+    pLease->remainRenewTime = t1;
+    pLease->remainRebindTime = t2;
+    pLease->deadlines.acquiredNs = nowNs;
+    pLease->deadlines.renewNs = nowNs + (uint64_t)t1 * 1000000000ULL;
+    pLease->deadlines.rebindNs = nowNs + (uint64_t)t2 * 1000000000ULL;
+    pLease->deadlines.expiryNs = nowNs + (uint64_t)pLease->leaseTime * 1000000000ULL;
+    return 0;
+}
+
+/* Parses and publishes the lease file of `module`, if it exists. */
+static void reader_refresh(const char *pDir, enum DHCPC_MODULE module)
+{
+    char path[PATH_MAX];
+    dhcpv4c_lease_snapshot_t lease;
+
+    snprintf(path, sizeof(path), "%s/%s" READER_LEASE_SUFFIX, pDir, g_ifNames[module]);
+    if (reader_parse_file(path, g_ifNames[module], reader_now_ns(), &lease) != 0) {
+        if (errno != ENOENT)
+            fprintf(stderr, "dhcpv4c_udhcpc_reader: %s: %s\n", path, strerror(errno));
+        return;
+    }
+    if (dhcpv4c_publish_lease(module, &lease) != STATUS_SUCCESS)
+        fprintf(stderr, "dhcpv4c_udhcpc_reader: publishing %s failed\n", g_ifNames[module]);
+}
+
+static void reader_refresh_all(const char *pDir)
+{
+    int m;
+
+    for (m = 0; m < DHCPC_MODULE_MAX; m++) {
+        if (g_ifNames[m][0] != '\0')
+            reader_refresh(pDir, (enum DHCPC_MODULE)m);
+    }
+}
+
+/* Handles a changed file name; only `<ifname>.lease` of a watched interface is parsed. */
+static void reader_on_file(const char *pDir, const char *pName)
+{
+    size_t len = strlen(pName);
+    size_t sfx = sizeof(READER_LEASE_SUFFIX) - 1;
+    int m;
+
+    if (len <= sfx || strcmp(pName + len - sfx, READER_LEASE_SUFFIX) != 0)
+        return;
+    for (m = 0; m < DHCPC_MODULE_MAX; m++) {
+        if (strlen(g_ifNames[m]) == len - sfx && strncmp(g_ifNames[m], pName, len - sfx) == 0)
+            reader_refresh(pDir, (enum DHCPC_MODULE)m);
+    }
+}
+
+static int reader_watch(const char *pDir)
+{
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    int fd;
+
+    fd = inotify_init1(IN_CLOEXEC);
+    if (fd < 0 || inotify_add_watch(fd, pDir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        perror("dhcpv4c_udhcpc_reader: inotify");
+        return -1;
+    }
+
+    /* Files written before the watch was added are picked up here. */
+    reader_refresh_all(pDir);
+
+    for (;;) {
+        ssize_t n = read(fd, buf, sizeof(buf));
+        char *p;
+
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("dhcpv4c_udhcpc_reader: read");
+            close(fd);
+            return -1;
+        }
+        for (p = buf; p < buf + n; ) {
+            const struct inotify_event *pEv = (const struct inotify_event *)p;
+
+            if (pEv->mask & IN_Q_OVERFLOW)
+                reader_refresh_all(pDir);
+            else if (pEv->len > 0)
+                reader_on_file(pDir, pEv->name);
+            p += sizeof(*pEv) + pEv->len;
+        }
+    }
+}
+
+static void reader_print(enum DHCPC_MODULE module)
+{
+    dhcpv4c_lease_snapshot_t s;
+
+    if (dhcpv4c_get_lease_snapshot(module, &s) != STATUS_SUCCESS) {
+        printf("{\"ifname\":\"%s\",\"status\":\"failure\"}\n", g_ifNames[module]);
+        return;
+    }
+    printf("{\"ifname\":\"%s\",\"fsm_state\":%d,\"ip_addr\":\"%u.%u.%u.%u\",\"lease_time\":%u,"
+           "\"remain_renew_time\":%u,\"remain_rebind_time\":%u,\"dns_svrs\":%d,\"generation\":%llu}\n",
+           s.ifName, s.fsmState,
+           (s.ipAddr >> 24) & 0xFF, (s.ipAddr >> 16) & 0xFF, (s.ipAddr >> 8) & 0xFF, s.ipAddr & 0xFF,
+           s.leaseTime, s.remainRenewTime, s.remainRebindTime, s.dnsSvrs.number,
+           (unsigned long long)s.generation);
+}
+
+static int reader_add_mapping(const char *pArg)
+{
+    const char *pIf = strchr(pArg, '=');
+    size_t i;
+
+    if (pIf == NULL || pIf[1] == '\0' || strlen(pIf + 1) >= DHCPV4_MAX_IFNAME_LEN)
+        return -1;
+    for (i = 0; i < sizeof(g_moduleNames) / sizeof(g_moduleNames[0]); i++) {
+        if (strlen(g_moduleNames[i].pName) == (size_t)(pIf - pArg) &&
+            strncmp(g_moduleNames[i].pName, pArg, (size_t)(pIf - pArg)) == 0) {
+            strcpy(g_ifNames[g_moduleNames[i].module], pIf + 1);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static void reader_usage(const char *pProg)
+{
+    fprintf(stderr, "usage: %s [-d dir] [-1] module=ifname...\n"
+                    "  module: ert, ecm"
+#if !defined (NO_MTA_FEATURE_SUPPORT)
+                    ", emta"
+#endif
+                    "\n", pProg);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pDir = DHCPV4C_UDHCPC_STATE_DIR;
+    BOOL once = FALSE;
+    int opt, m;
+
+    while ((opt = getopt(argc, argv, "d:1h")) != -1) {
+        switch (opt) {
+        case 'd':
+            pDir = optarg;
+            break;
+        case '1':
+            once = TRUE;
+            break;
+        default:
+            reader_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (optind >= argc) {
+        reader_usage(argv[0]);
+        return 1;
+    }
+    for (; optind < argc; optind++) {
+        if (reader_add_mapping(argv[optind]) != 0) {
+            reader_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (once) {
+        reader_refresh_all(pDir);
+        for (m = 0; m < DHCPC_MODULE_MAX; m++) {
+            if (g_ifNames[m][0] != '\0')
+                reader_print((enum DHCPC_MODULE)m);
+        }
+        return 0;
+    }
+
+    if (mkdir(pDir, 0755) != 0 && errno != EEXIST) {
+        perror("dhcpv4c_udhcpc_reader: mkdir");
+        return 1;
+    }
+    return (reader_watch(pDir) == 0) ? 0 : 1;
+}
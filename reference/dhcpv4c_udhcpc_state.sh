@@ -0,0 +1,58 @@
+#!/bin/sh
+#
+# If not stated otherwise in this file or this component's LICENSE file the
+# following copyright and licenses apply:
+#
+# Copyright 2023 RDK Management
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Reference writer of the udhcpc lease-state files read by the open-source backend.
+#
+# Call it from the platform's udhcpc script with the udhcpc event as $1, after the
+# interface has been configured. udhcpc must be started with "-O 58 -O 59" so that
+# T1 and T2 are exported as opt58 and opt59.
+#
+# The file is written to a temporary name in the same directory and renamed, so a
+# reader never sees a partial file.
+
+dir=${DHCPV4C_UDHCPC_STATE_DIR:-/tmp/udhcpc}
+
+case "$1" in
+    deconfig|leasefail|bound|renew) ;;
+    *) exit 0 ;;
+esac
+[ -n "$interface" ] || exit 1
+
+mkdir -p "$dir" || exit 1
+
+# Configuration attempts: 1 when the client starts, plus one per failed attempt.
+count="$dir/.$interface.attempts"
+attempts=$(cat "$count" 2>/dev/null)
+case "$1" in
+    deconfig)  [ "${attempts:-0}" -gt 0 ] || attempts=1 ;;
+    leasefail) attempts=$((${attempts:-0} + 1)) ;;
+esac
+echo "${attempts:-0}" > "$count"
+
+tmp="$dir/.$interface.lease.$$"
+{
+    echo "event=$1"
+    echo "attempts=${attempts:-0}"
+    for key in ip subnet router dns serverid lease; do
+        eval value=\$$key
+        [ -n "$value" ] && echo "$key=$value"
+    done
+    env | grep '^opt[0-9][0-9]*=' || :
+} > "$tmp" && mv -f "$tmp" "$dir/$interface.lease"